@@ -1,17 +1,51 @@
 #include "DataBind.hpp"
 
+#include "core/config/engine.h"
 #include "core/error/error_macros.h"
+#include "core/io/json.h"
+#include "core/io/marshalls.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
 
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
+#include "scene/gui/item_list.h"
+#include "scene/gui/line_edit.h"
+#include "scene/gui/option_button.h"
+#include "scene/gui/slider.h"
+#include "scene/gui/spin_box.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+#include <cstdio>
 
 using namespace CG;
 
+LocalVector<DataBind *> DataBind::instances;
+HashMap<StringName, uint8_t> DataBind::tag_bits;
+LocalVector<DataBind::DataBindPropertyInfo> DataBind::properties;
+HashMap<StringName, uint32_t> DataBind::property_ids;
+Callable DataBind::texture_resolver;
+HashMap<Variant, Ref<Texture2D>, VariantHasher, VariantComparator> DataBind::textures;
+
 Node *init_scene(const String &p_path) {
 	const Ref<PackedScene> scene = ResourceLoader::load(p_path);
 	ERR_FAIL_COND_V_MSG(scene == nullptr, nullptr, String("Error initializing:" + p_path));
 	return scene->instantiate();
 }
 
+DataBind::DataBind() {
+	pressed_buttons.set_arena(&arena);
+	text_formats.set_arena(&arena);
+	tr_texts.set_arena(&arena);
+	item_lists.set_arena(&arena);
+	progress_bars.set_arena(&arena);
+	two_ways.set_arena(&arena);
+	texture_keys.set_arena(&arena);
+	datamodel_batches.set_arena(&arena);
+	base_instance = this; // DataBinds with a script call its methods through Callables and Expressions
+}
+
 DataBind *DataBind::init(const String &p_path) {
 	DataBind *databind = Object::cast_to<DataBind>(init_scene(p_path));
 	ERR_FAIL_NULL_V_MSG(databind, nullptr, vformat("Failed to init DataBind scene: %s", p_path));
@@ -21,187 +55,2135 @@ DataBind *DataBind::init(const String &p_path) {
 }
 
 void DataBind::init_databind() {
+	if (properties.is_empty())
+		register_builtin_properties();
+
+	// Datamodel getters run while registering
+	if (snapshot_source != nullptr)
+		snapshot_source->pin();
+
 	_find_metadata_properties(this);
+	connect("child_entered_tree", callable_mp(this, &DataBind::_on_child_entered_tree));
+	connect("child_exiting_tree", callable_mp(this, &DataBind::_on_child_exiting_tree));
+	instances.push_back(this);
 	set_physics_process(true);
 }
 
-Ref<Expression> DataBind::get_expression(const String &expression_string) {
-	const Ref<Expression> expression = memnew(Expression());
-	const Error err = expression->parse(expression_string);
+Ref<DataBindExpression> DataBind::get_expression(const String &expression_string) {
+	const Ref<DataBindExpression> expression = arena.make_ref<DataBindExpression>();
+	const Error err = expression->parse(expression_string, base_instance);
 	if (err != OK)
 		print_error(expression->get_error_text());
 
 	return expression;
 }
 
-const Array dummy_input_array; // empty array must be passed into Expression::execute
+uint64_t DataBind::get_tag_mask(const String &p_tags) {
+	uint64_t mask = 0;
+	for (const String &tag : p_tags.split(",", false)) {
+		const StringName tag_name = tag.strip_edges();
+		const uint8_t *bit = tag_bits.getptr(tag_name);
+		if (bit == nullptr) {
+			ERR_FAIL_COND_V_MSG(tag_bits.size() >= 64, 0, "Too many DataBind tags, properties tagged with '" + tag + "' will be executed every update.");
+			bit = &tag_bits.insert(tag_name, tag_bits.size())->value;
+		}
+		mask |= uint64_t(1) << *bit;
+	}
+
+	return mask;
+}
+
+void DataBind::invalidate(const StringName &p_tag) {
+	const uint8_t *bit = tag_bits.getptr(p_tag);
+	if (bit == nullptr)
+		return; // Nothing is tagged with p_tag
+
+	const uint64_t mask = uint64_t(1) << *bit;
+	for (DataBind *databind : instances)
+		databind->dirty_tags |= mask;
+}
 
-template <typename T> void DataBind::execute(const T &callable, Control *node, const StringName &method, Variant::Type expected_type, const StringName &expected_class) {
-	// If the method to call doesn't exist there is no reason to even execute the expression
+uint32_t DataBind::add_property(const StringName &meta, const StringName &property, const StringName &setter, Variant::Type type, const StringName &class_name) {
+	DataBindPropertyInfo info;
+	info.meta = meta;
+	info.property = property;
+	info.setter = setter;
+	info.type = type;
+	info.class_name = class_name;
+	properties.push_back(info);
+	property_ids.insert(meta, properties.size() - 1);
+	return properties.size() - 1;
+}
 
-	ERR_FAIL_COND_MSG(!node->has_method(method), String("Executing " + method + " expression for " + String(node->get_path()) + " failed: " + method + " does not exist."));
-	Variant result;
+// Same order as DataBindProperty.
+void DataBind::register_builtin_properties() {
+	add_property(SNAME("visible"), SNAME("visible"), SNAME("set_visible"), Variant::BOOL);
+	add_property(SNAME("disabled"), SNAME("disabled"), SNAME("set_disabled"), Variant::BOOL);
+	add_property(SNAME("text"), SNAME("text"), SNAME("set_text"), Variant::STRING);
+	add_property(SNAME("texture"), SNAME("texture"), SNAME("set_texture"), Variant::OBJECT, SNAME("Texture2D"));
+	add_property(SNAME("icon"), SNAME("icon"), SNAME("set_button_icon"), Variant::OBJECT, SNAME("Texture2D"));
+	add_property(SNAME("tooltip"), SNAME("tooltip_text"), SNAME("set_tooltip_text"), Variant::STRING);
+	add_property(SNAME("progress"), SNAME("value"), SNAME("set_value_no_signal"), Variant::FLOAT);
+}
+
+void DataBind::register_property(const StringName &p_meta, const StringName &p_property) {
+	if (properties.is_empty())
+		register_builtin_properties();
+
+	ERR_FAIL_COND_MSG(property_ids.has(p_meta), "DataBind property '" + p_meta + "' is already registered.");
+	add_property(p_meta, p_property, StringName(), Variant::NIL);
+}
+
+// Returns -1 if meta is not a bindable property, bind_<property> metadata is registered the first time it is used.
+int DataBind::get_property_id(const StringName &meta) {
+	const uint32_t *id = property_ids.getptr(meta);
+	if (id != nullptr)
+		return *id;
+
+	const String name = meta;
+	if (!name.begins_with("bind_"))
+		return -1;
+
+	return add_property(meta, name.substr(5), StringName(), Variant::NIL);
+}
+
+// Resolve the setter of a property once per Control class, every binding of the property on that class then calls the MethodBind directly.
+DataBind::DataBindSetter DataBind::get_setter(uint32_t property_id, const StringName &class_name) {
+	DataBindPropertyInfo &info = properties[property_id];
+	const DataBindSetter *cached = info.setters.getptr(class_name);
+	if (cached != nullptr)
+		return *cached;
+
+	DataBindSetter setter;
+	setter.type = info.type;
+	setter.class_name = info.class_name;
+	if (!info.setter.is_empty()) {
+		setter.method = ClassDB::get_method(class_name, info.setter);
+	} else {
+		PropertyInfo property_info;
+		if (ClassDB::get_property_info(class_name, info.property, &property_info)) {
+			setter.method = ClassDB::get_method(class_name, ClassDB::get_property_setter(class_name, info.property));
+			setter.type = property_info.type;
+			if (property_info.type == Variant::OBJECT and property_info.hint == PROPERTY_HINT_RESOURCE_TYPE)
+				setter.class_name = property_info.hint_string.get_slicec(',', 0);
+		}
+	}
+
+	info.setters.insert(class_name, setter);
+	return setter;
+}
+
+void DataBind::call_setter(Control *node, MethodBind *setter, const Variant &value) {
+	ERR_FAIL_NULL(setter);
+	const Variant *args[1] = { &value };
+	Callable::CallError call_error;
+	setter->call(node, args, 1, call_error);
+}
+
+DataBind::DataBindGetter DataBind::get_getter(const String &p_method) {
+	DataBindGetter getter;
+	getter.method = ClassDB::get_method(base_instance->get_class_name(), p_method);
+	if (getter.method == nullptr)
+		getter.expression = get_expression(p_method);
+
+	return getter;
+}
+
+bool DataBind::get_value(const DataBindGetter &p_getter, Variant &r_value) const {
+	if (p_getter.method != nullptr) {
+		Callable::CallError call_error;
+		r_value = p_getter.method->call(base_instance, nullptr, 0, call_error);
+		return call_error.error == Callable::CallError::CALL_OK;
+	}
+
+	return p_getter.expression->execute(base_instance, r_value);
+}
+
+String DataBind::get_getter_error(const DataBindGetter &p_getter) {
+	if (p_getter.method != nullptr)
+		return "Calling " + p_getter.method->get_name() + " failed.";
+	return p_getter.expression->get_error_text();
+}
+
+template <typename T> DataBind::DataBindFailure DataBind::execute(const T &callable, const DataBindSetter &setter, Variant &result) {
+	// Failures are not formatted here, they are counted and only the first one is logged. See binding_failed.
+
+	// If the Control doesn't have the property there is no reason to even execute the expression
+	if (setter.method == nullptr)
+		return FAILURE_MISSING_METHOD;
 
 	// Check if T is an Expression or Callable and get result
-	if constexpr (std::is_same_v<std::decay_t<T>, Ref<Expression>>) {
-		result = callable->execute(dummy_input_array, base_instance);
-		ERR_FAIL_COND_MSG(callable->has_execute_failed(), String("Executing " + method + " expression for " + String(node->get_path()) + " failed: " + callable->get_error_text()));
+	if constexpr (std::is_same_v<std::decay_t<T>, Ref<DataBindExpression>>) {
+		if (!callable->execute(base_instance, result))
+			return FAILURE_EXECUTE;
 	} else if constexpr (std::is_same_v<std::decay_t<T>, MethodBind *>) {
 		Callable::CallError call_error;
 		result = callable->call(base_instance, nullptr, 0, call_error);
+		if (call_error.error != Callable::CallError::CALL_OK)
+			return FAILURE_EXECUTE;
 	}
 
 	// If variant types don't match return
-	if (result.get_type() != expected_type) {
-		if ((expected_type == Variant::STRING && result.get_type() == Variant::INT)) { // allow int if expected type is String.
+	if (setter.type != Variant::NIL and result.get_type() != setter.type) {
+		if ((setter.type == Variant::STRING && result.get_type() == Variant::INT)) // allow int if expected type is String.
 			result = result.stringify();
-		} else {
-			print_error(String("Executing " + method + " expression for " + String(node->get_path()) + " failed: Result type is " + Variant::get_type_name(result.get_type()) +
-					" expected: " + Variant::get_type_name(expected_type)));
-			return;
-		}
+		else if (setter.type == Variant::FLOAT && result.get_type() == Variant::INT) // and for float properties
+			result = double(result);
+		else
+			return FAILURE_TYPE;
 	}
 
 	// If type is Object also verify that the class is correct.
-	if (!expected_class.is_empty() and result.get_type() == Variant::OBJECT) {
-		Object *obj = Object::cast_to<Object>(result); // need to cast to call is_class
+	if (!setter.class_name.is_empty() and result.get_type() == Variant::OBJECT) {
+		const Object *obj = Object::cast_to<Object>(result); // need to cast to call is_class
+		if (obj == nullptr or !obj->is_class(setter.class_name)) // obj being null should be impossible but happens anyway sometimes
+			return FAILURE_CLASS;
+	}
+
+	return FAILURE_NONE;
+}
+
+template <typename T>
+String DataBind::get_failure_message(DataBindFailure failure, const T &callable, Control *node, uint32_t property_id, const DataBindSetter &setter, const Variant &result) {
+	const DataBindPropertyInfo &info = properties[property_id];
+	const String prefix = "Executing " + info.meta + " expression for " + String(node->get_path()) + " failed: ";
+	switch (failure) {
+		case FAILURE_MISSING_METHOD:
+			return prefix + node->get_class() + " has no " + (info.setter.is_empty() ? info.property : info.setter) + ".";
+		case FAILURE_EXECUTE: {
+			if constexpr (std::is_same_v<std::decay_t<T>, Ref<DataBindExpression>>)
+				return prefix + callable->get_error_text();
+			else
+				return prefix + "Calling " + callable->get_name() + " failed.";
+		}
+		case FAILURE_TYPE:
+			return prefix + "Result type is " + Variant::get_type_name(result.get_type()) + " expected: " + Variant::get_type_name(setter.type);
+		case FAILURE_CLASS: {
+			const Object *obj = Object::cast_to<Object>(result);
+			return prefix + "Result class is " + (obj == nullptr ? String("null") : obj->get_class()) + " expected: " + setter.class_name;
+		}
+		case FAILURE_NONE:
+			break;
+	}
+
+	return prefix;
+}
 
-		ERR_FAIL_NULL(obj); // This should be impossible but happens anyway sometimes
-		ERR_FAIL_COND_MSG(!obj->is_class(expected_class),
-				String("Executing " + method + " expression for " + String(node->get_path()) + " failed: Result class is " + Variant::get_type_name(result.get_type()) +
-						" expected: " + expected_class));
+template <typename F> void DataBind::binding_failed(DataBindStatus &status, Control *node, const StringName &property, const F &get_message) {
+	DataBindError *error = errors.getptr(status.id);
+	if (error == nullptr) {
+		// Only the first failure of a binding is formatted and logged, after that failures are just counted.
+		error = &errors.insert(status.id, DataBindError())->value;
+		error->path = node->get_path();
+		error->property = property;
+		error->message = get_message();
+		print_error(error->message + " Further failures of this binding are not logged.");
 	}
 
-	// Call the godot method with the result of the expression
-	// For example if the metadata is 'visible', this will call the set_visible method.
-	node->call(method, result);
+	error->failures++;
+	if (++status.failures < QUARANTINE_FAILURES)
+		return;
+
+	// Skip the binding until retry_frame, every quarantine in a row doubles the wait and a single failure of the retry quarantines it again.
+	status.retry_frame = frame + (QUARANTINE_FRAMES << MIN(error->quarantines, QUARANTINE_MAX_BACKOFF));
+	status.failures = QUARANTINE_FAILURES - 1;
+	error->retry_frame = status.retry_frame;
+	error->quarantines++;
+}
+
+void DataBind::binding_recovered(DataBindStatus &status) {
+	status.failures = 0;
+	DataBindError *error = errors.getptr(status.id);
+	if (error != nullptr)
+		error->quarantines = 0;
 }
 
 void DataBind::setup_pressed(Control *node) {
 	if (node->has_meta("pressed") and node->is_class("BaseButton")) {
+		DataBindPressed pressed;
+		pressed.node = node;
+
 		const String &pressed_method = node->get_meta("pressed");
 		Callable pressed_callable = Callable(base_instance, pressed_method);
 
 		if (!pressed_callable.is_valid()) {
 			// If callable has arguments try making it an Expression
-			const Ref<Expression> expression = get_expression(pressed_method);
-			pressed_expressions.push_back(expression); // need to take ownership or signals won't work
-			pressed_callable = callable_mp(*expression, &Expression::execute).bind(dummy_input_array, base_instance, true, false);
+			pressed.expression = get_expression(pressed_method);
+			pressed_callable = callable_mp(*pressed.expression, &DataBindExpression::call).bind(base_instance);
 
 			ERR_FAIL_COND_MSG(!pressed_callable.is_valid(), "Callable '" + pressed_method + "' assigned to 'pressed' signal for " + node->get_name() + " is not valid.");
 		}
+
+		// pressed_refresh can be true to refresh this DataBind or a String of tags to refresh, either way the refresh happens right after the pressed method returns
+		// so the result shows up on the same frame instead of on the next physics tick.
+		const Variant refresh = node->get_meta("pressed_refresh", false);
+		if (refresh.get_type() == Variant::STRING or (refresh.get_type() == Variant::BOOL and bool(refresh))) {
+			const uint64_t refresh_tags = refresh.get_type() == Variant::STRING ? get_tag_mask(refresh) : 0;
+			pressed_callable = callable_mp(this, &DataBind::_on_pressed_refresh).bind(pressed_callable, refresh_tags);
+		}
+
+		pressed.callable = pressed_callable;
 		node->connect("pressed", pressed_callable);
+		add_ref(node, TABLE_PRESSED, pressed_buttons.size());
+		pressed_buttons.push_back(pressed);
 	}
 }
 
-void DataBind::setup_datamodel(Control *node) {
-	if (!node->has_meta("datamodel"))
-		return;
+void DataBind::_on_pressed_refresh(const Callable &p_callable, uint64_t p_tags) {
+	p_callable.call();
 
-	const Callable callable = Callable(base_instance, node->get_meta("datamodel"));
-	const Array result = callable.call();
-	for (const Variant &var : result) {
-		Node *item = Object::cast_to<Node>(var);
-		if (item == nullptr)
-			continue;
+	// 0 refreshes every property of this DataBind
+	if (p_tags == 0) {
+		if (is_inside_tree())
+			update();
+		return;
+	}
 
-		node->add_child(item);
+	for (DataBind *databind : instances) {
+		databind->dirty_tags |= p_tags;
+		if (databind->is_inside_tree())
+			databind->update(true);
 	}
 }
 
-#define SET_PROPERTY(m_property, m_type)                                                                                                                                                     \
-	if (node->has_meta(m_property)) {                                                                                                                                                        \
-		MethodBind *method = ClassDB::get_method(base_instance->get_class_name(), node->get_meta(m_property));                                                                               \
-                                                                                                                                                                                             \
-		if (method != nullptr) {                                                                                                                                                             \
-			DataBindCallableProperty property;                                                                                                                                               \
-			property.property_type = m_type;                                                                                                                                                 \
-			property.callable = method;                                                                                                                                                      \
-			data_bind_node.callable_properties.push_back(property);                                                                                                                          \
-		} else {                                                                                                                                                                             \
-			DataBindExpressionProperty property;                                                                                                                                             \
-			property.property_type = m_type;                                                                                                                                                 \
-			property.callable = get_expression(node->get_meta(m_property));                                                                                                                  \
-			data_bind_node.expression_properties.push_back(property);                                                                                                                        \
-		}                                                                                                                                                                                    \
-	}
+void DataBind::setup_text_format(Control *node, uint64_t tags) {
+	if (!node->has_meta("text_format"))
+		return;
 
-void DataBind::_find_metadata_properties(Node *node_to_check) { // NOLINT(misc-no-recursion)
-	const TypedArray<Node> children = node_to_check->get_children(false);
-	for (const Variant &child : children) {
-		Control *node = Object::cast_to<Control>(child);
-		if (node == nullptr)
+	MethodBind *setter = get_setter(TEXT, node->get_class_name()).method;
+	ERR_FAIL_NULL_MSG(setter, "text_format can't be used on " + String(node->get_path()) + ": set_text does not exist.");
+
+	DataBindTextFormat text_format;
+	text_format.setter = setter;
+	text_format.status.id = next_binding_id++;
+	text_format.node = node;
+	text_format.tags = tags;
+
+	const Array args = node->get_meta("text_format_args", Array());
+	ERR_FAIL_COND_MSG(args.size() > INT8_MAX, "Too many text_format_args for " + String(node->get_path()));
+	for (const Variant &arg : args)
+		text_format.args.push_back(get_getter(arg));
+
+	// Split the template into literal text and {index} or {index:decimals} placeholders once so updating never has to parse it.
+	const String format = node->get_meta("text_format");
+	int literal_start = 0;
+	for (int i = 0; i < format.length(); ++i) {
+		if (format[i] != '{')
 			continue;
 
-		if (node->get_child_count() > 0)
-			_find_metadata_properties(node);
+		const int end = format.find_char('}', i);
+		if (end == -1)
+			break;
 
-		DataBindNode data_bind_node;
+		const String placeholder = format.substr(i + 1, end - i - 1);
+		const int separator = placeholder.find_char(':');
+		const String index = separator == -1 ? placeholder : placeholder.substr(0, separator);
+		if (!index.is_valid_int())
+			continue;
 
-		SET_PROPERTY("visible", VISIBLE)
-		SET_PROPERTY("text", TEXT)
-		SET_PROPERTY("texture", TEXTURE)
-		SET_PROPERTY("icon", ICON)
-		SET_PROPERTY("tooltip", TOOLTIP)
-		SET_PROPERTY("progress", PROGRESS)
+		const int arg = index.to_int();
+		ERR_CONTINUE_MSG(arg < 0 or arg >= args.size(), vformat("text_format placeholder {%d} for %s has no matching text_format_args entry.", arg, node->get_path()));
 
-		setup_pressed(node);
-		setup_datamodel(node);
+		DataBindTextSegment segment;
+		segment.literal = format.substr(literal_start, i - literal_start);
+		segment.arg = arg;
+		segment.decimals = separator == -1 ? 0 : CLAMP(placeholder.substr(separator + 1).to_int(), 0, 9);
+		text_format.segments.push_back(segment);
 
-		if (data_bind_node.expression_properties.size() > 0 or data_bind_node.callable_properties.size() > 0) {
-			data_bind_node.node = node;
-			nodes.push_back(data_bind_node);
-		}
+		literal_start = end + 1;
+		i = end;
 	}
+
+	if (literal_start < format.length()) {
+		DataBindTextSegment segment;
+		segment.literal = format.substr(literal_start);
+		text_format.segments.push_back(segment);
+	}
+
+	add_ref(node, TABLE_TEXT_FORMAT, text_formats.size());
+	text_formats.push_back(text_format);
 }
 
-void DataBind::_notification(int p_what) {
-	switch (p_what) {
-		case NOTIFICATION_PHYSICS_PROCESS: {
-			update();
-		} break;
+static void append_text(LocalVector<char32_t> &r_buffer, const char32_t *p_text, int p_length) {
+	for (int i = 0; i < p_length; ++i)
+		r_buffer.push_back(p_text[i]);
+}
+
+static void append_digits(LocalVector<char32_t> &r_buffer, uint64_t p_value, int p_min_digits = 1) {
+	char32_t digits[20];
+	int count = 0;
+	while (p_value > 0 or count < p_min_digits) {
+		digits[count++] = U'0' + p_value % 10;
+		p_value /= 10;
 	}
+
+	while (count > 0)
+		r_buffer.push_back(digits[--count]);
 }
 
-template <typename T> _ALWAYS_INLINE_ void DataBind::update_properties(Control *node, const T &property) {
-	// Have to run visible property every update no matter what, for all other properties only update if the Control is visible.
-	if (property.property_type != VISIBLE and !node->is_visible_in_tree())
-		return;
+// Enough for the integer digits of DBL_MAX, a sign, the point and up to 9 decimals.
+static constexpr int FLOAT_TEXT_SIZE = 330;
 
-	switch (property.property_type) {
-		case VISIBLE: {
-			execute(property.callable, node, SNAME("set_visible"), Variant::BOOL);
-		} break;
-		case DISABLED: {
-			execute(property.callable, node, SNAME("set_disabled"), Variant::BOOL);
+// Format a float with p_decimals decimals into a stack buffer. printf is what String::num uses too, so both the update and the reference
+// check round the same way: ties go to even on the exact binary value (2.5 is "2", 0.125 with 2 decimals is "0.12") and -0.4 is "-0".
+static int format_float(char (&r_text)[FLOAT_TEXT_SIZE], double p_value, uint8_t p_decimals) {
+	const int length = MIN(snprintf(r_text, FLOAT_TEXT_SIZE, "%.*f", int(p_decimals), p_value), FLOAT_TEXT_SIZE - 1);
+	for (int i = 0; i < length; ++i) {
+		if (r_text[i] == ',') // Locales with a decimal comma
+			r_text[i] = '.';
+	}
+	return length;
+}
+
+// Render a getter result without going through Variant::stringify so no temporary Strings are allocated for numbers.
+static void append_value(LocalVector<char32_t> &r_buffer, const Variant &p_value, uint8_t p_decimals) {
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
 		} break;
-		case TEXT: {
-			execute(property.callable, node, SNAME("set_text"), Variant::STRING);
+		case Variant::BOOL: {
+			if (bool(p_value))
+				append_text(r_buffer, U"true", 4);
+			else
+				append_text(r_buffer, U"false", 5);
 		} break;
-		case TEXTURE: {
-			execute(property.callable, node, SNAME("set_texture"), Variant::OBJECT, SNAME("Texture2D"));
+		case Variant::INT: {
+			const int64_t value = p_value;
+			if (value < 0)
+				r_buffer.push_back('-');
+			append_digits(r_buffer, value < 0 ? uint64_t(0) - uint64_t(value) : uint64_t(value));
 		} break;
-		case ICON: {
-			execute(property.callable, node, SNAME("set_button_icon"), Variant::OBJECT, SNAME("Texture2D"));
+		case Variant::FLOAT: {
+			char text[FLOAT_TEXT_SIZE];
+			const int length = format_float(text, p_value, p_decimals);
+			for (int i = 0; i < length; ++i)
+				r_buffer.push_back(char32_t(text[i]));
 		} break;
-		case TOOLTIP: {
-			execute(property.callable, node, SNAME("set_tooltip_text"), Variant::STRING);
+		case Variant::STRING: {
+			const String text = p_value; // shares the Variant's buffer
+			append_text(r_buffer, text.ptr(), text.length());
 		} break;
-		case PROGRESS: {
-			execute(property.callable, node, SNAME("set_value_no_signal"), Variant::FLOAT);
+		default: {
+			const String text = p_value.stringify();
+			append_text(r_buffer, text.ptr(), text.length());
 		} break;
 	}
 }
 
-void DataBind::update() {
-	for (const DataBindNode &data_bind_node : nodes) {
-		for (const DataBindCallableProperty &property : data_bind_node.callable_properties)
-			update_properties(data_bind_node.node, property);
-		for (const DataBindExpressionProperty &property : data_bind_node.expression_properties)
-			update_properties(data_bind_node.node, property);
+const DataBind::DataBindGetter *DataBind::update_text_format(DataBindTextFormat &text_format) {
+	text_format.buffer.clear();
+	for (const DataBindTextSegment &segment : text_format.segments) {
+		append_text(text_format.buffer, segment.literal.ptr(), segment.literal.length());
+		if (segment.arg == -1)
+			continue;
+
+		Variant value;
+		if (!get_value(text_format.args[segment.arg], value))
+			return &text_format.args[segment.arg];
+		append_value(text_format.buffer, value, segment.decimals);
 	}
+
+	// Only create a String and call set_text if the rendered characters actually changed.
+	const uint32_t length = text_format.buffer.size();
+	if (length == text_format.rendered.size() and memcmp(text_format.buffer.ptr(), text_format.rendered.ptr(), length * sizeof(char32_t)) == 0)
+		return nullptr;
+
+	text_format.rendered = text_format.buffer;
+	text_format.buffer.push_back(0);
+	const String text = String(text_format.buffer.ptr());
+	trace_apply(text);
+	queue_set(text_format.node, text_format.setter, text);
+	return nullptr;
 }
 
-void DataBind::set_base_instance(Object *p_object) { base_instance = p_object; }
+void DataBind::setup_tr_text(Control *node, const StringName &meta, DataBindProperty property, uint64_t tags) {
+	if (!node->has_meta(meta))
+		return;
+
+	MethodBind *setter = get_setter(property, node->get_class_name()).method;
+	ERR_FAIL_NULL_MSG(setter, String(meta) + " can't be used on " + String(node->get_path()) + ": " + properties[property].setter + " does not exist.");
+
+	DataBindTrText tr_text;
+	tr_text.status.id = next_binding_id++;
+	tr_text.node = node;
+	tr_text.property = property;
+	tr_text.setter = setter;
+	tr_text.tags = tags;
+
+	// The key is either a method or Expression that returns the translation key, or the key itself. Script methods without arguments
+	// are called through an Expression like every other getter of a script.
+	const String key = node->get_meta(meta);
+	if (ClassDB::get_method(base_instance->get_class_name(), key) != nullptr or key.contains_char('('))
+		tr_text.key_getter = get_getter(key);
+	else if (base_instance->has_method(key))
+		tr_text.key_getter = get_getter(key + "()");
+	else
+		tr_text.key = StringName(key);
+
+	const Array args = node->get_meta(String(meta) + "_args", Array());
+	for (const Variant &arg : args)
+		tr_text.args.push_back(get_getter(arg));
+	tr_text.arg_values.resize(args.size());
+
+	add_ref(node, TABLE_TR_TEXT, tr_texts.size());
+	tr_texts.push_back(tr_text);
+}
+
+const DataBind::DataBindGetter *DataBind::update_tr_text(DataBindTrText &tr_text) {
+	// Only translate and format again if the translation, key, or any of the args changed.
+	bool changed = tr_text.translation_changed;
+
+	if (tr_text.key_getter.is_valid()) {
+		Variant key;
+		if (!get_value(tr_text.key_getter, key))
+			return &tr_text.key_getter;
+		if (key != tr_text.key) {
+			tr_text.key = key;
+			changed = true;
+		}
+	}
+
+	for (uint32_t i = 0; i < tr_text.args.size(); ++i) {
+		Variant value;
+		if (!get_value(tr_text.args[i], value))
+			return &tr_text.args[i];
+		if (value != tr_text.arg_values[i]) {
+			tr_text.arg_values.set(i, value);
+			changed = true;
+		}
+	}
+
+	tr_text.translation_changed = false;
+	if (!changed)
+		return nullptr;
+
+	String text = tr(tr_text.key);
+	if (!tr_text.args.is_empty())
+		text = text.format(tr_text.arg_values);
+
+	if (text != tr_text.text) {
+		tr_text.text = text;
+		trace_apply(text);
+		queue_set(tr_text.node, tr_text.setter, text);
+	}
+
+	return nullptr;
+}
+
+void DataBind::setup_texture_key(Control *node, const StringName &meta, DataBindProperty property, uint64_t tags) {
+	if (!node->has_meta(meta))
+		return;
+
+	MethodBind *setter = get_setter(property, node->get_class_name()).method;
+	ERR_FAIL_NULL_MSG(setter, String(meta) + " can't be used on " + String(node->get_path()) + ": " + properties[property].setter + " does not exist.");
+
+	DataBindTextureKey texture_key;
+	texture_key.status.id = next_binding_id++;
+	texture_key.node = node;
+	texture_key.property = property;
+	texture_key.setter = setter;
+	texture_key.tags = tags;
+	texture_key.getter = get_getter(node->get_meta(meta));
+
+	add_ref(node, TABLE_TEXTURE_KEY, texture_keys.size());
+	texture_keys.push_back(texture_key);
+}
+
+const DataBind::DataBindGetter *DataBind::update_texture_key(DataBindTextureKey &texture_key) {
+	// Comparing keys is a lot cheaper than looking the texture up every update, the texture is only resolved and set when the key changes.
+	Variant key;
+	if (!get_value(texture_key.getter, key))
+		return &texture_key.getter;
+	if (key == texture_key.key)
+		return nullptr;
+
+	texture_key.key = key;
+	const Ref<Texture2D> texture = resolve_texture(key);
+	trace_apply(texture);
+	queue_set(texture_key.node, texture_key.setter, texture);
+	return nullptr;
+}
+
+Ref<Texture2D> DataBind::resolve_texture(const Variant &key) {
+	if (key.get_type() == Variant::NIL)
+		return Ref<Texture2D>();
+
+	const Ref<Texture2D> *cached = textures.getptr(key);
+	if (cached != nullptr)
+		return *cached;
+
+	Variant result;
+	if (texture_resolver.is_valid())
+		result = texture_resolver.call(key);
+	else if (key.get_type() == Variant::STRING or key.get_type() == Variant::STRING_NAME)
+		result = ResourceLoader::load(key);
+	else
+		ERR_PRINT("Texture key " + key.stringify() + " is not a resource path and there is no texture resolver, see DataBind.set_texture_resolver.");
+
+	// The class is only checked here, a key that doesn't resolve to a Texture2D is cached as null so it is only reported once.
+	const Ref<Texture2D> texture = result;
+	if (texture.is_null() and result.get_type() != Variant::NIL) {
+		const Object *obj = result;
+		ERR_PRINT("Texture key " + key.stringify() + " resolved to " + (obj == nullptr ? Variant::get_type_name(result.get_type()) : obj->get_class()) + " expected: Texture2D");
+	}
+
+	textures.insert(key, texture);
+	return texture;
+}
+
+void DataBind::set_texture_resolver(const Callable &p_resolver) {
+	texture_resolver = p_resolver;
+	clear_texture_cache();
+}
+
+void DataBind::clear_texture_cache() {
+	textures.clear();
+	for (DataBind *databind : instances) {
+		for (DataBindTextureKey &texture_key : databind->texture_keys) {
+			texture_key.key = Variant();
+			texture_key.dirty = true;
+		}
+	}
+}
+
+void DataBind::setup_items(Control *node, uint64_t tags) {
+	if (!node->has_meta("items"))
+		return;
+
+	ItemList *item_list = Object::cast_to<ItemList>(node);
+	OptionButton *option_button = Object::cast_to<OptionButton>(node);
+	ERR_FAIL_COND_MSG(item_list == nullptr and option_button == nullptr, "items can't be used on " + String(node->get_path()) + ": it is not an ItemList or OptionButton.");
+
+	// Start from an empty list so the cached items always match the items of the node.
+	if (item_list != nullptr)
+		item_list->clear();
+	else
+		option_button->clear();
+
+	DataBindItems items;
+	items.status.id = next_binding_id++;
+	items.node = node;
+	items.tags = tags;
+	items.getter = get_getter(node->get_meta("items"));
+
+	add_ref(node, TABLE_ITEMS, item_lists.size());
+	item_lists.push_back(items);
+}
+
+void DataBind::setup_progress(Control *node, uint64_t tags) {
+	Range *range = Object::cast_to<Range>(node);
+	ERR_FAIL_COND_MSG(range == nullptr, "progress_rate can't be used on " + String(node->get_path()) + ": it is not a Range.");
+	ERR_FAIL_COND_MSG(!node->has_meta("progress"), "progress_rate can't be used on " + String(node->get_path()) + " without progress.");
+
+	const double rate = node->get_meta("progress_rate");
+	ERR_FAIL_COND_MSG(rate <= 0.0, "progress_rate of " + String(node->get_path()) + " must be greater than 0.");
+
+	DataBindProgress progress;
+	progress.status.id = next_binding_id++;
+	progress.node = range;
+	progress.tags = tags;
+	progress.getter = get_getter(node->get_meta("progress"));
+	progress.rate_frames = MAX(1, int(Math::round(rate * Engine::get_singleton()->get_physics_ticks_per_second())));
+	progress.duration = rate;
+	progress.elapsed = rate;
+	progress.snap = node->get_meta("progress_snap", 0.0);
+
+	add_ref(node, TABLE_PROGRESS, progress_bars.size());
+	progress_bars.push_back(progress);
+}
+
+const DataBind::DataBindGetter *DataBind::update_progress(DataBindProgress &progress) {
+	if (frame < progress.next_sample_frame) {
+		progress.dirty = true; // Keep tagged progress bars dirty until they can be sampled again
+		return nullptr;
+	}
+
+	Variant result;
+	if (!get_value(progress.getter, result))
+		return &progress.getter;
+
+	progress.next_sample_frame = frame + progress.rate_frames;
+	const double value = result;
+	if (progress.sampled and value == progress.to)
+		return nullptr;
+
+	// The first sample and big jumps are set right away, everything else is interpolated from the displayed value until the next sample.
+	const double displayed = progress.node->get_value();
+	if (!progress.sampled or (progress.snap > 0.0 and Math::abs(value - displayed) >= progress.snap)) {
+		progress.sampled = true;
+		progress.from = value;
+		progress.to = value;
+		progress.elapsed = progress.duration;
+		progress.node->set_value_no_signal(value);
+		trace_apply(value);
+		return nullptr;
+	}
+
+	trace_apply(value);
+	progress.from = displayed;
+	progress.to = value;
+	progress.elapsed = 0.0;
+	set_process_internal(true);
+	return nullptr;
+}
+
+void DataBind::interpolate_progress(double p_delta) {
+	// Render frames can run without a physics frame in between, bars freed since the last update must be removed before touching them.
+	if (!exited_nodes.is_empty())
+		remove_exited_nodes();
+
+	bool interpolating = false;
+	for (DataBindProgress &progress : progress_bars) {
+		if (progress.elapsed >= progress.duration)
+			continue;
+
+		progress.elapsed = MIN(progress.elapsed + p_delta, progress.duration);
+		progress.node->set_value_no_signal(Math::lerp(progress.from, progress.to, progress.elapsed / progress.duration));
+		interpolating = interpolating or progress.elapsed < progress.duration;
+	}
+
+	if (!interpolating)
+		set_process_internal(false);
+}
+
+void DataBind::setup_two_way(Control *node, uint64_t tags) {
+	if (!node->has_meta("two_way"))
+		return;
+
+	DataBindTwoWay two_way;
+	two_way.node = node;
+	two_way.tags = tags;
+
+	// The signal that reports user changes and a setter that doesn't emit it, so reading never writes the value back.
+	SpinBox *spin_box = Object::cast_to<SpinBox>(node);
+	if (Object::cast_to<LineEdit>(node) != nullptr) {
+		two_way.changed_signal = SNAME("text_changed");
+		two_way.setter = ClassDB::get_method(node->get_class_name(), SNAME("set_text"));
+		two_way.edit_source = node;
+		two_way.edit_started_signal = SNAME("focus_entered");
+		two_way.edit_ended_signal = SNAME("focus_exited");
+	} else if (Object::cast_to<Range>(node) != nullptr) {
+		two_way.changed_signal = SNAME("value_changed");
+		two_way.setter = ClassDB::get_method(node->get_class_name(), SNAME("set_value_no_signal"));
+		if (spin_box != nullptr) {
+			two_way.edit_source = spin_box->get_line_edit();
+			two_way.edit_started_signal = SNAME("focus_entered");
+			two_way.edit_ended_signal = SNAME("focus_exited");
+		} else if (Object::cast_to<Slider>(node) != nullptr) {
+			two_way.edit_source = node;
+			two_way.edit_started_signal = SNAME("drag_started");
+			two_way.edit_ended_signal = SNAME("drag_ended");
+		}
+	} else if (Object::cast_to<BaseButton>(node) != nullptr) {
+		two_way.changed_signal = SNAME("toggled");
+		two_way.setter = ClassDB::get_method(node->get_class_name(), SNAME("set_pressed_no_signal"));
+	}
+	ERR_FAIL_NULL_MSG(two_way.setter, "two_way can't be used on " + String(node->get_path()) + ": it is not a LineEdit, Range, or BaseButton.");
+
+	const String write = node->get_meta("two_way_write", String());
+	two_way.write = ClassDB::get_method(base_instance->get_class_name(), write);
+	ERR_FAIL_NULL_MSG(two_way.write, "two_way_write of " + String(node->get_path()) + " must be a method of " + base_instance->get_class() + " with one argument.");
+
+	two_way.status.id = next_binding_id++;
+	two_way.getter = get_getter(node->get_meta("two_way"));
+	two_way.changed = callable_mp(this, &DataBind::_on_two_way_changed).bind(node);
+	node->connect(two_way.changed_signal, two_way.changed);
+	if (two_way.edit_source != nullptr) {
+		two_way.edit_started = callable_mp(this, &DataBind::_on_two_way_editing).bind(true, node);
+		two_way.edit_ended = callable_mp(this, &DataBind::_on_two_way_editing).bind(false, node);
+		if (two_way.edit_ended_signal == SNAME("drag_ended"))
+			two_way.edit_ended = two_way.edit_ended.unbind(1); // drag_ended passes value_changed
+		two_way.edit_source->connect(two_way.edit_started_signal, two_way.edit_started);
+		two_way.edit_source->connect(two_way.edit_ended_signal, two_way.edit_ended);
+	}
+
+	add_ref(node, TABLE_TWO_WAY, two_ways.size());
+	two_ways.push_back(two_way);
+}
+
+void DataBind::disconnect_two_way(const DataBindTwoWay &two_way) {
+	two_way.node->disconnect(two_way.changed_signal, two_way.changed);
+	if (two_way.edit_source != nullptr) {
+		two_way.edit_source->disconnect(two_way.edit_started_signal, two_way.edit_started);
+		two_way.edit_source->disconnect(two_way.edit_ended_signal, two_way.edit_ended);
+	}
+}
+
+DataBind::DataBindTwoWay *DataBind::get_two_way(Control *node) {
+	const DataBindRegisteredNode *registered = registered_nodes.getptr(node);
+	if (registered == nullptr)
+		return nullptr;
+
+	for (const DataBindRef &ref : registered->refs) {
+		if (ref.table == TABLE_TWO_WAY)
+			return &two_ways[ref.index];
+	}
+
+	return nullptr;
+}
+
+// Only the latest value is kept, dragging a slider writes once per update instead of once per value_changed.
+void DataBind::_on_two_way_changed(const Variant &p_value, Control *p_node) {
+	DataBindTwoWay *two_way = get_two_way(p_node);
+	ERR_FAIL_NULL(two_way);
+
+	if (!two_way->write_pending)
+		pending_writes++;
+	two_way->write_pending = true;
+	two_way->pending = p_value;
+}
+
+void DataBind::_on_two_way_editing(bool p_editing, Control *p_node) {
+	DataBindTwoWay *two_way = get_two_way(p_node);
+	ERR_FAIL_NULL(two_way);
+
+	two_way->editing = p_editing;
+	two_way->dirty = true; // Read the game state again once editing ends
+}
+
+void DataBind::write_two_ways() {
+	for (DataBindTwoWay &two_way : two_ways) {
+		if (!two_way.write_pending)
+			continue;
+
+		two_way.write_pending = false;
+		two_way.value = two_way.pending;
+		const Variant *args[1] = { &two_way.pending };
+		Callable::CallError call_error;
+		two_way.write->call(base_instance, args, 1, call_error);
+		if (unlikely(call_error.error != Callable::CallError::CALL_OK))
+			binding_failed(two_way.status, two_way.node, SNAME("two_way_write"), [&]() { return "Calling " + two_way.write->get_name() + " for " + String(two_way.node->get_path()) + " failed."; });
+	}
+
+	pending_writes = 0;
+}
+
+const DataBind::DataBindGetter *DataBind::update_two_way(DataBindTwoWay &two_way) {
+	if (two_way.editing) {
+		two_way.dirty = true; // Keep tagged two_ways dirty until editing ends
+		return nullptr;
+	}
+
+	Variant result;
+	if (!get_value(two_way.getter, result))
+		return &two_way.getter;
+	if (result == two_way.value)
+		return nullptr;
+
+	two_way.value = result;
+	trace_apply(result);
+	queue_set(two_way.node, two_way.setter, result);
+	return nullptr;
+}
+
+// Diff item descriptors against the cached items and only call the setters for fields that changed.
+// ItemList and OptionButton have the same item API so this works for both.
+template <typename T> void DataBind::apply_items(T *p_node, LocalVector<DataBindItem> &r_items, const Array &p_descriptors) {
+	const int count = p_descriptors.size();
+	if (int(r_items.size()) != count) {
+		p_node->set_item_count(count);
+		r_items.resize(count);
+	}
+
+	for (int i = 0; i < count; ++i) {
+		const Variant &descriptor = p_descriptors[i];
+		DataBindItem &item = r_items[i];
+
+		// A String is a shorthand for an item that only has text.
+		if (descriptor.get_type() == Variant::STRING) {
+			const String text = descriptor;
+			if (text != item.text) {
+				item.text = text;
+				p_node->set_item_text(i, text);
+			}
+			continue;
+		}
+
+		ERR_CONTINUE_MSG(descriptor.get_type() != Variant::DICTIONARY, "items descriptors must be a Dictionary or String, got " + Variant::get_type_name(descriptor.get_type()));
+		const Dictionary dict = descriptor;
+
+		const String text = dict.get(SNAME("text"), String());
+		if (text != item.text) {
+			item.text = text;
+			p_node->set_item_text(i, text);
+		}
+
+		const Ref<Texture2D> icon = dict.get(SNAME("icon"), Variant());
+		if (icon != item.icon) {
+			item.icon = icon;
+			p_node->set_item_icon(i, icon);
+		}
+
+		const String tooltip = dict.get(SNAME("tooltip"), String());
+		if (tooltip != item.tooltip) {
+			item.tooltip = tooltip;
+			p_node->set_item_tooltip(i, tooltip);
+		}
+
+		const bool disabled = dict.get(SNAME("disabled"), false);
+		if (disabled != item.disabled) {
+			item.disabled = disabled;
+			p_node->set_item_disabled(i, disabled);
+		}
+
+		const Variant metadata = dict.get(SNAME("metadata"), Variant());
+		if (metadata != item.metadata) {
+			item.metadata = metadata;
+			p_node->set_item_metadata(i, metadata);
+		}
+	}
+}
+
+const DataBind::DataBindGetter *DataBind::update_items(DataBindItems &items) {
+	Variant result;
+	if (!get_value(items.getter, result) or result.get_type() != Variant::ARRAY)
+		return &items.getter;
+
+	trace_apply(result);
+	apply_items(items, result);
+	return nullptr;
+}
+
+void DataBind::apply_items(DataBindItems &items, const Array &descriptors) {
+	ItemList *item_list = Object::cast_to<ItemList>(items.node);
+	if (item_list != nullptr)
+		apply_items(item_list, items.items, descriptors);
+	else
+		apply_items(Object::cast_to<OptionButton>(items.node), items.items, descriptors);
+}
+
+void DataBind::setup_datamodel(Control *node) {
+	if (!node->has_meta("datamodel") or datamodel_nodes.has(node->get_instance_id()))
+		return;
+
+	// Datamodels call into the game, a replay only contains the bindings of this DataBind.
+	if (replaying)
+		return;
+
+	datamodel_nodes.insert(node->get_instance_id());
+
+	const Callable callable = Callable(base_instance, node->get_meta("datamodel"));
+	const Array result = callable.call();
+	for (const Variant &var : result) {
+		Node *item = Object::cast_to<Node>(var);
+		if (item == nullptr)
+			continue;
 
-void DataBind::_bind_methods() {}
+		node->add_child(item);
+	}
+}
+
+void DataBind::setup_datamodel_batch(Control *node, uint64_t tags) {
+	if (!node->has_meta("datamodel_batch"))
+		return;
+
+	ERR_FAIL_COND_MSG(!node->has_meta("datamodel"), "datamodel_batch can't be used on " + String(node->get_path()) + " without datamodel.");
+
+	// Keys are the path of a Control in every datamodel child with the property as subname, like "VBoxContainer/Label:text".
+	const Dictionary batches = node->get_meta("datamodel_batch");
+	const Array keys = batches.keys();
+	for (const Variant &key : keys) {
+		const NodePath path = key;
+		const int property_id = path.get_subname_count() == 1 ? get_property_id(path.get_subname(0)) : -1;
+		ERR_CONTINUE_MSG(property_id == -1, "datamodel_batch key '" + String(path) + "' of " + String(node->get_path()) + " doesn't end with a bindable property.");
+
+		DataBindBatch batch;
+		batch.status.id = next_binding_id++;
+		batch.node = node;
+		batch.tags = tags;
+		batch.property_id = property_id;
+		batch.path = NodePath(path.get_names(), false);
+		batch.getter = get_getter(batches[key]);
+
+		add_ref(node, TABLE_DATAMODEL_BATCH, datamodel_batches.size());
+		datamodel_batches.push_back(batch);
+	}
+
+	const Callable children_changed = callable_mp(this, &DataBind::_on_datamodel_children_changed).bind(node);
+	if (!node->is_connected("child_order_changed", children_changed))
+		node->connect("child_order_changed", children_changed);
+}
+
+void DataBind::_on_datamodel_children_changed(Control *p_node) {
+	const DataBindRegisteredNode *registered = registered_nodes.getptr(p_node);
+	if (registered == nullptr)
+		return;
+
+	for (const DataBindRef &ref : registered->refs) {
+		if (ref.table == TABLE_DATAMODEL_BATCH) {
+			datamodel_batches[ref.index].rebuild = true;
+			datamodel_batches[ref.index].dirty = true;
+		}
+	}
+}
+
+// Resolved again whenever children are added, removed or moved, child i of the datamodel always gets element i.
+void DataBind::resolve_batch_targets(DataBindBatch &batch) {
+	batch.rebuild = false;
+	batch.targets.clear();
+	for (int i = 0; i < batch.node->get_child_count(false); ++i) {
+		Node *child = batch.node->get_child(i, false);
+		Control *control = Object::cast_to<Control>(batch.path.is_empty() ? child : child->get_node_or_null(batch.path));
+
+		DataBindBatchTarget target;
+		if (control != nullptr) {
+			const DataBindSetter setter = get_setter(batch.property_id, control->get_class_name());
+			if (setter.method != nullptr) {
+				target.id = control->get_instance_id();
+				target.setter = setter.method;
+				target.type = setter.type;
+
+				// The item can bind the same property itself for when it is used without the batch, the batch replaces that binding.
+				for (DataBind *databind : instances) {
+					if (databind != this)
+						databind->release_property(control, batch.property_id);
+				}
+			}
+		}
+		batch.targets.push_back(target);
+	}
+}
+
+// Same conversions execute allows.
+static Variant get_batch_value(Variant::Type p_type, const Variant &p_value) {
+	if (p_type == Variant::STRING and p_value.get_type() != Variant::STRING)
+		return p_value.stringify();
+	if (p_type == Variant::FLOAT and p_value.get_type() == Variant::INT)
+		return double(p_value);
+	return p_value;
+}
+
+template <typename T> void DataBind::apply_batch_values(DataBindBatch &batch, const T &values) {
+	const uint32_t count = MIN(uint32_t(values.size()), batch.targets.size());
+	for (uint32_t i = 0; i < count; ++i) {
+		DataBindBatchTarget &target = batch.targets[i];
+		const Variant value = values[i];
+		if (target.setter == nullptr or value == target.value)
+			continue;
+
+		Control *node = Object::cast_to<Control>(ObjectDB::get_instance(target.id));
+		if (unlikely(node == nullptr)) {
+			batch.rebuild = true; // The Control was freed without its child leaving the datamodel
+			continue;
+		}
+
+		target.value = value;
+		queue_set(node, target.setter, get_batch_value(target.type, value));
+	}
+}
+
+// Returns false if values is not an array.
+bool DataBind::apply_batch(DataBindBatch &batch, const Variant &values) {
+	if (batch.rebuild)
+		resolve_batch_targets(batch);
+
+	switch (values.get_type()) {
+		case Variant::PACKED_INT32_ARRAY:
+			apply_batch_values(batch, PackedInt32Array(values));
+			return true;
+		case Variant::PACKED_INT64_ARRAY:
+			apply_batch_values(batch, PackedInt64Array(values));
+			return true;
+		case Variant::PACKED_FLOAT32_ARRAY:
+			apply_batch_values(batch, PackedFloat32Array(values));
+			return true;
+		case Variant::PACKED_FLOAT64_ARRAY:
+			apply_batch_values(batch, PackedFloat64Array(values));
+			return true;
+		case Variant::PACKED_STRING_ARRAY:
+			apply_batch_values(batch, PackedStringArray(values));
+			return true;
+		case Variant::ARRAY:
+			apply_batch_values(batch, Array(values));
+			return true;
+		default:
+			return false;
+	}
+}
+
+const DataBind::DataBindGetter *DataBind::update_datamodel_batch(DataBindBatch &batch) {
+	// One call for every child instead of one getter per child, the elements are compared with what was last set so only children
+	// whose value changed are set.
+	Variant values;
+	if (!get_value(batch.getter, values) or !apply_batch(batch, values))
+		return &batch.getter;
+
+	trace_apply(values);
+	return nullptr;
+}
+
+void DataBind::resize_groups() {
+	const uint32_t count = callable_groups.size();
+	callable_groups.resize(properties.size());
+	expression_groups.resize(properties.size());
+	for (uint32_t i = count; i < properties.size(); ++i) {
+		callable_groups[i].set_arena(&arena);
+		expression_groups[i].set_arena(&arena);
+	}
+}
+
+void DataBind::bind_property(Control *node, uint32_t property_id, uint64_t tags) {
+	if (property_id >= callable_groups.size())
+		resize_groups();
+
+	const DataBindSetter setter = get_setter(property_id, node->get_class_name());
+	const String getter = node->get_meta(properties[property_id].meta);
+	MethodBind *method = ClassDB::get_method(base_instance->get_class_name(), getter);
+	if (method != nullptr)
+		add_ref(node, TABLE_GROUPS + property_id * 2, callable_groups[property_id].push_back(node, method, setter, tags, next_binding_id++));
+	else
+		add_ref(node, TABLE_GROUPS + property_id * 2 + 1, expression_groups[property_id].push_back(node, get_expression(getter), setter, tags, next_binding_id++));
+}
+
+void DataBind::register_node(Control *node) {
+	DataBindRegisteredNode &registered = registered_nodes[node];
+	registered.id = node->get_instance_id();
+	registered.refs.set_arena(&arena);
+	if (!node->is_connected("child_entered_tree", callable_mp(this, &DataBind::_on_child_entered_tree))) {
+		node->connect("child_entered_tree", callable_mp(this, &DataBind::_on_child_entered_tree));
+		node->connect("child_exiting_tree", callable_mp(this, &DataBind::_on_child_exiting_tree));
+	}
+
+	// Count how often Containers sort their children to verify that an update only causes one layout pass per Container.
+	if (Object::cast_to<Container>(node) != nullptr)
+		node->connect("sort_children", callable_mp(this, &DataBind::_on_sort_children));
+
+	const uint64_t tags = node->has_meta("tags") ? get_tag_mask(node->get_meta("tags")) : 0;
+
+	List<StringName> metas;
+	node->get_meta_list(&metas);
+	for (const StringName &meta : metas) {
+		const int property_id = get_property_id(meta);
+		if (property_id == -1)
+			continue;
+
+		// Progress bars with a progress_rate are sampled at that rate and interpolated every frame instead.
+		if (property_id == PROGRESS and node->has_meta("progress_rate"))
+			continue;
+
+		bind_property(node, property_id, tags);
+	}
+
+	if (node->has_meta("progress_rate"))
+		setup_progress(node, tags);
+
+	setup_pressed(node);
+	setup_datamodel(node);
+	setup_text_format(node, tags);
+	setup_tr_text(node, SNAME("tr_text"), TEXT, tags);
+	setup_tr_text(node, SNAME("tr_tooltip"), TOOLTIP, tags);
+	setup_items(node, tags);
+	setup_two_way(node, tags);
+	setup_texture_key(node, SNAME("texture_key"), TEXTURE, tags);
+	setup_texture_key(node, SNAME("icon_key"), ICON, tags);
+	setup_datamodel_batch(node, tags);
+}
+
+void DataBind::add_ref(Control *node, uint16_t table, uint32_t index) {
+	DataBindRef ref;
+	ref.table = table;
+	ref.index = index;
+	registered_nodes[node].refs.push_back(ref);
+}
+
+uint32_t DataBind::get_table_size(uint16_t table) const {
+	if (table >= TABLE_GROUPS) {
+		const uint32_t property_id = (table - TABLE_GROUPS) / 2;
+		return (table - TABLE_GROUPS) % 2 == 0 ? callable_groups[property_id].size() : expression_groups[property_id].size();
+	}
+
+	switch (table) {
+		case TABLE_TEXT_FORMAT:
+			return text_formats.size();
+		case TABLE_TR_TEXT:
+			return tr_texts.size();
+		case TABLE_PRESSED:
+			return pressed_buttons.size();
+		case TABLE_ITEMS:
+			return item_lists.size();
+		case TABLE_PROGRESS:
+			return progress_bars.size();
+		case TABLE_TWO_WAY:
+			return two_ways.size();
+		case TABLE_TEXTURE_KEY:
+			return texture_keys.size();
+		case TABLE_DATAMODEL_BATCH:
+			return datamodel_batches.size();
+	}
+
+	return 0;
+}
+
+uint32_t DataBind::get_binding_id(uint16_t table, uint32_t index) const {
+	if (table >= TABLE_GROUPS) {
+		const uint32_t property_id = (table - TABLE_GROUPS) / 2;
+		return (table - TABLE_GROUPS) % 2 == 0 ? callable_groups[property_id].status[index].id : expression_groups[property_id].status[index].id;
+	}
+
+	switch (table) {
+		case TABLE_TEXT_FORMAT:
+			return text_formats[index].status.id;
+		case TABLE_TR_TEXT:
+			return tr_texts[index].status.id;
+		case TABLE_ITEMS:
+			return item_lists[index].status.id;
+		case TABLE_PROGRESS:
+			return progress_bars[index].status.id;
+		case TABLE_TWO_WAY:
+			return two_ways[index].status.id;
+		case TABLE_TEXTURE_KEY:
+			return texture_keys[index].status.id;
+		case TABLE_DATAMODEL_BATCH:
+			return datamodel_batches[index].status.id;
+	}
+
+	return UINT32_MAX; // Not a binding that is executed every update
+}
+
+template <typename T> static Control *remove_row(ArenaVector<T> &rows, uint32_t index) {
+	rows.remove_at_unordered(index);
+	return index < rows.size() ? rows[index].node : nullptr;
+}
+
+Control *DataBind::remove_from_table(uint16_t table, uint32_t index) {
+	if (table >= TABLE_GROUPS) {
+		const uint32_t property_id = (table - TABLE_GROUPS) / 2;
+		return (table - TABLE_GROUPS) % 2 == 0 ? callable_groups[property_id].remove_at(index) : expression_groups[property_id].remove_at(index);
+	}
+
+	switch (table) {
+		case TABLE_TEXT_FORMAT:
+			return remove_row(text_formats, index);
+		case TABLE_TR_TEXT:
+			return remove_row(tr_texts, index);
+		case TABLE_PRESSED:
+			return remove_row(pressed_buttons, index);
+		case TABLE_ITEMS:
+			return remove_row(item_lists, index);
+		case TABLE_PROGRESS:
+			return remove_row(progress_bars, index);
+		case TABLE_TWO_WAY: {
+			if (two_ways[index].write_pending)
+				pending_writes--;
+			return remove_row(two_ways, index);
+		}
+		case TABLE_TEXTURE_KEY:
+			return remove_row(texture_keys, index);
+		case TABLE_DATAMODEL_BATCH:
+			return remove_row(datamodel_batches, index);
+	}
+
+	return nullptr;
+}
+
+void DataBind::unregister_node(Control *node, bool p_alive) {
+	DataBindRegisteredNode *registered = registered_nodes.getptr(node);
+	if (registered == nullptr)
+		return;
+
+	if (p_alive) {
+		node->disconnect("child_entered_tree", callable_mp(this, &DataBind::_on_child_entered_tree));
+		node->disconnect("child_exiting_tree", callable_mp(this, &DataBind::_on_child_exiting_tree));
+		if (Object::cast_to<Container>(node) != nullptr)
+			node->disconnect("sort_children", callable_mp(this, &DataBind::_on_sort_children));
+	}
+
+	for (const DataBindRef &ref : registered->refs) {
+		if (ref.table == TABLE_PRESSED and p_alive)
+			node->disconnect("pressed", pressed_buttons[ref.index].callable);
+		if (ref.table == TABLE_TWO_WAY and p_alive)
+			disconnect_two_way(two_ways[ref.index]);
+		if (ref.table == TABLE_DATAMODEL_BATCH and p_alive) {
+			const Callable children_changed = callable_mp(this, &DataBind::_on_datamodel_children_changed).bind(node);
+			if (node->is_connected("child_order_changed", children_changed))
+				node->disconnect("child_order_changed", children_changed);
+		}
+
+		remove_binding(ref);
+	}
+
+	registered_nodes.erase(node);
+}
+
+void DataBind::remove_binding(const DataBindRef &ref) {
+	if (!errors.is_empty())
+		errors.erase(get_binding_id(ref.table, ref.index));
+
+	// Tables are swap removed so the ref of the binding that was moved into the removed slot has to be updated.
+	const uint32_t last = get_table_size(ref.table) - 1;
+	Control *moved = remove_from_table(ref.table, ref.index);
+	if (moved == nullptr)
+		return;
+
+	DataBindRegisteredNode *moved_registered = registered_nodes.getptr(moved);
+	ERR_FAIL_NULL(moved_registered);
+	for (DataBindRef &moved_ref : moved_registered->refs) {
+		if (moved_ref.table == ref.table and moved_ref.index == last) {
+			moved_ref.index = ref.index;
+			break;
+		}
+	}
+}
+
+// Remove the binding of property_id from node so a datamodel_batch of the DataBind that owns the datamodel sets it instead.
+void DataBind::release_property(Control *node, uint32_t property_id) {
+	DataBindRegisteredNode *registered = registered_nodes.getptr(node);
+	if (registered == nullptr)
+		return;
+
+	const uint16_t callable_table = TABLE_GROUPS + property_id * 2;
+	uint32_t i = 0;
+	while (i < registered->refs.size()) {
+		const DataBindRef ref = registered->refs[i];
+		if (ref.table != callable_table and ref.table != callable_table + 1) {
+			i++;
+			continue;
+		}
+
+		registered->refs.remove_at_unordered(i);
+		remove_binding(ref);
+	}
+}
+
+void DataBind::remove_exited_nodes() {
+	for (const DataBindExitedNode &exited : exited_nodes) {
+		const DataBindRegisteredNode *registered = registered_nodes.getptr(exited.node);
+		if (registered == nullptr or registered->id != exited.id)
+			continue; // Already removed
+
+		// Controls also exit when the whole DataBind is removed from the tree, keep them if they are still part of this DataBind.
+		const Node *node = Object::cast_to<Node>(ObjectDB::get_instance(exited.id));
+		if (node != nullptr and is_ancestor_of(node))
+			continue;
+
+		unregister_node(exited.node, node != nullptr);
+	}
+
+	exited_nodes.clear();
+	arena.collect(); // Free the Expressions of the removed bindings
+}
+
+void DataBind::_on_child_entered_tree(Node *p_node) {
+	Control *node = Object::cast_to<Control>(p_node);
+	if (node == nullptr or Object::cast_to<DataBind>(node) != nullptr)
+		return;
+
+	// Datamodel items belong to their own DataBind even if their root isn't one.
+	const Node *parent = node->get_parent();
+	if (parent != nullptr and datamodel_nodes.has(parent->get_instance_id()))
+		return;
+
+	const DataBindRegisteredNode *registered = registered_nodes.getptr(node);
+	if (registered != nullptr) {
+		if (registered->id == node->get_instance_id())
+			return; // Re-entered without leaving this DataBind
+		unregister_node(node, false); // Freed Control at the same address
+	}
+
+	// Children of node emit child_entered_tree after node so only node has to be registered here.
+	register_node(node);
+}
+
+void DataBind::_on_child_exiting_tree(Node *p_node) {
+	Control *node = Object::cast_to<Control>(p_node);
+	if (node == nullptr or !registered_nodes.has(node))
+		return;
+
+	// Removing the bindings has to wait until update, if the Control is only exiting because this DataBind is exiting its bindings should be kept.
+	DataBindExitedNode exited;
+	exited.node = node;
+	exited.id = node->get_instance_id();
+	exited_nodes.push_back(exited);
+}
+
+void DataBind::_find_metadata_properties(Node *node_to_check) { // NOLINT(misc-no-recursion)
+	const TypedArray<Node> children = node_to_check->get_children(false);
+	for (const Variant &child : children) {
+		Control *node = Object::cast_to<Control>(child);
+		if (node == nullptr or Object::cast_to<DataBind>(node) != nullptr)
+			continue;
+
+		// Children of a datamodel are its items, which are bound by their own DataBind.
+		if (node->get_child_count() > 0 and !node->has_meta("datamodel"))
+			_find_metadata_properties(node);
+
+		register_node(node);
+	}
+}
+
+void DataBind::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_PHYSICS_PROCESS: {
+			frame++;
+			last_layout_passes = layout_passes;
+			layout_passes = 0;
+			const uint64_t start = OS::get_singleton()->get_ticks_usec();
+			update();
+			last_update_usec = OS::get_singleton()->get_ticks_usec() - start;
+			if (unlikely(reference_check_interval != 0) and frame % reference_check_interval == 0)
+				check_reference();
+		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			interpolate_progress(get_process_delta_time());
+		} break;
+		case NOTIFICATION_TRANSLATION_CHANGED: {
+			for (DataBindTrText &tr_text : tr_texts) {
+				tr_text.translation_changed = true;
+				tr_text.dirty = true;
+			}
+		} break;
+		case NOTIFICATION_PREDELETE: {
+			instances.erase(this);
+			if (instances.is_empty())
+				textures.clear(); // Release the cached textures with the last DataBind
+		} break;
+	}
+}
+
+_ALWAYS_INLINE_ bool DataBind::is_property_dirty(bool &r_dirty, uint64_t p_tags, uint64_t p_invalidated_tags, bool p_tagged_only) {
+	// Tagged properties only run after one of their tags has been invalidated, untagged properties are polled every update.
+	// Dirty is kept until the property actually runs so hidden controls still get updated once they become visible.
+	if (p_tags == 0)
+		return !p_tagged_only;
+
+	r_dirty |= (p_tags & p_invalidated_tags) != 0;
+	return r_dirty;
+}
+
+template <typename T> void DataBind::update_group(uint32_t property_id, DataBindGroup<T> &group, uint64_t p_invalidated_tags, bool p_tagged_only) {
+	if (group.size() == 0)
+		return;
+
+	const StringName meta = properties[property_id].meta;
+	for (uint32_t i = 0; i < group.size(); ++i) {
+		if (!is_property_dirty(group.dirty[i], group.tags[i], p_invalidated_tags, p_tagged_only) or is_quarantined(group.status[i]))
+			continue;
+
+		// Have to run visible property every update no matter what, for all other properties only update if the Control is visible.
+		Control *node = group.nodes[i];
+		if (property_id != VISIBLE and !node->is_visible_in_tree())
+			continue;
+
+		group.dirty[i] = false;
+		const bool tracing = trace.is_valid();
+		const uint64_t start = tracing ? OS::get_singleton()->get_ticks_usec() : 0;
+		Variant result;
+		const DataBindFailure failure = execute(group.callables[i], group.setters[i], result);
+		const uint64_t usec = tracing ? OS::get_singleton()->get_ticks_usec() - start : 0;
+		if (unlikely(failure != FAILURE_NONE)) {
+			binding_failed(group.status[i], node, meta, [&]() { return get_failure_message(failure, group.callables[i], node, property_id, group.setters[i], result); });
+			continue;
+		}
+
+		if (unlikely(group.status[i].failures != 0))
+			binding_recovered(group.status[i]);
+
+		// Visible is compared with the Control itself since game code hiding or showing it has to be undone on the next update.
+		const bool changed = property_id == VISIBLE ? bool(result) != node->is_visible() : result != group.values[i];
+		if (unlikely(tracing))
+			trace_binding(group.status[i].id, result, usec, changed);
+
+		if (changed)
+			apply_group_value(property_id, group, i, result);
+	}
+}
+
+// Call the godot method with the result of the expression
+// For example if the metadata is 'visible', this will call the set_visible method.
+// Visible is set right away since every other property depends on it, everything else is set in apply_pending_sets.
+template <typename T> void DataBind::apply_group_value(uint32_t property_id, DataBindGroup<T> &group, uint32_t index, const Variant &value) {
+	group.values[index] = value;
+	if (property_id == VISIBLE)
+		call_setter(group.nodes[index], group.setters[index].method, value);
+	else
+		queue_set(group.nodes[index], group.setters[index].method, value);
+}
+
+void DataBind::queue_set(Control *node, MethodBind *setter, const Variant &value) {
+	DataBindPendingSet pending_set;
+	pending_set.node = node;
+	pending_set.setter = setter;
+	pending_set.value = value;
+	pending_sets.push_back(pending_set);
+}
+
+void DataBind::apply_pending_sets() {
+	// All setters run back to back after every getter so the minimum size changes of one update all happen before godot's deferred
+	// minimum size and Container sort updates, each Container then sorts its children once for the whole update.
+	for (const DataBindPendingSet &pending_set : pending_sets)
+		call_setter(pending_set.node, pending_set.setter, pending_set.value);
+
+	pending_sets.clear();
+}
+
+void DataBind::_on_sort_children() { layout_passes++; }
+
+TypedArray<Dictionary> DataBind::get_quarantined_bindings() const {
+	TypedArray<Dictionary> quarantined;
+	for (const KeyValue<uint32_t, DataBindError> &error : errors) {
+		if (error.value.retry_frame <= frame)
+			continue;
+
+		Dictionary binding;
+		binding["path"] = error.value.path;
+		binding["property"] = error.value.property;
+		binding["failures"] = error.value.failures;
+		binding["quarantines"] = error.value.quarantines;
+		binding["retry_frames"] = error.value.retry_frame - frame;
+		binding["error"] = error.value.message;
+		quarantined.push_back(binding);
+	}
+
+	return quarantined;
+}
+
+Dictionary DataBind::get_arena_stats() const { return arena.get_stats(); }
+
+uint32_t DataBind::get_layout_passes() const { return last_layout_passes; }
+
+// Update every row of a table that stores one binding per row, update_row returns the getter that failed or nullptr.
+template <typename T>
+void DataBind::update_rows(ArenaVector<T> &rows, const StringName &property, const DataBindGetter *(DataBind::*update_row)(T &), uint64_t p_invalidated_tags, bool p_tagged_only) {
+	for (T &row : rows) {
+		if (!is_property_dirty(row.dirty, row.tags, p_invalidated_tags, p_tagged_only) or is_quarantined(row.status) or !row.node->is_visible_in_tree())
+			continue;
+
+		row.dirty = false;
+		const bool tracing = trace.is_valid();
+		const uint64_t start = tracing ? OS::get_singleton()->get_ticks_usec() : 0;
+		trace_applied = false;
+		const DataBindGetter *failed = (this->*update_row)(row);
+		if (unlikely(tracing and failed == nullptr)) {
+			trace_binding(row.status.id, trace_applied ? trace_value : Variant(), OS::get_singleton()->get_ticks_usec() - start, trace_applied);
+			trace_value = Variant();
+		}
+
+		if (unlikely(failed != nullptr)) {
+			binding_failed(row.status, row.node, property, [&]() { return "Executing " + property + " for " + String(row.node->get_path()) + " failed: " + get_getter_error(*failed); });
+			continue;
+		}
+
+		if (unlikely(row.status.failures != 0))
+			binding_recovered(row.status);
+	}
+}
+
+void DataBind::update(bool p_tagged_only) {
+	if (!exited_nodes.is_empty())
+		remove_exited_nodes();
+
+	if (unlikely(trace.is_valid()))
+		trace->store_8(TRACE_UPDATE);
+
+	// Every getter of this update reads the same snapshot even if the simulation publishes a new one in the middle of it.
+	if (snapshot_source != nullptr)
+		snapshot_source->pin();
+
+	// User changes are written before anything is read so the reads already see them.
+	if (pending_writes != 0)
+		write_two_ways();
+
+	const uint64_t invalidated_tags = dirty_tags;
+	dirty_tags = 0;
+
+	// Visible goes first so every other property sees the visibility of this update.
+	for (uint32_t property_id = 0; property_id < callable_groups.size(); ++property_id) {
+		update_group(property_id, callable_groups[property_id], invalidated_tags, p_tagged_only);
+		update_group(property_id, expression_groups[property_id], invalidated_tags, p_tagged_only);
+	}
+
+	update_rows(text_formats, SNAME("text_format"), &DataBind::update_text_format, invalidated_tags, p_tagged_only);
+	update_rows(tr_texts, SNAME("tr_text"), &DataBind::update_tr_text, invalidated_tags, p_tagged_only);
+	update_rows(item_lists, SNAME("items"), &DataBind::update_items, invalidated_tags, p_tagged_only);
+	update_rows(progress_bars, SNAME("progress"), &DataBind::update_progress, invalidated_tags, p_tagged_only);
+	update_rows(two_ways, SNAME("two_way"), &DataBind::update_two_way, invalidated_tags, p_tagged_only);
+	update_rows(texture_keys, SNAME("texture_key"), &DataBind::update_texture_key, invalidated_tags, p_tagged_only);
+	update_rows(datamodel_batches, SNAME("datamodel_batch"), &DataBind::update_datamodel_batch, invalidated_tags, p_tagged_only);
+
+	apply_pending_sets();
+}
+
+void DataBind::set_base_instance(Object *p_object) { base_instance = p_object; }
+
+void DataBind::set_snapshot_source(DataBindSnapshotSource *p_source) { snapshot_source = p_source; }
+
+// Reference mode runs the original update on top of the optimised one: every binding is executed, its setter is called right away and the
+// resulting property is compared with the property the optimised update left behind. Tagged bindings are included, a tagged binding
+// that diverges is missing an invalidate.
+void DataBind::check_reference() {
+	reference_divergences.clear();
+	for (uint32_t property_id = 0; property_id < callable_groups.size(); ++property_id) {
+		check_reference_group(property_id, callable_groups[property_id]);
+		check_reference_group(property_id, expression_groups[property_id]);
+	}
+
+	for (DataBindTextFormat &text_format : text_formats) {
+		if (!is_quarantined(text_format.status) and text_format.node->is_visible_in_tree())
+			check_reference_text_format(text_format);
+	}
+
+	for (DataBindTrText &tr_text : tr_texts) {
+		if (!is_quarantined(tr_text.status) and tr_text.node->is_visible_in_tree())
+			check_reference_tr_text(tr_text);
+	}
+
+	for (DataBindItems &items : item_lists) {
+		if (!is_quarantined(items.status) and items.node->is_visible_in_tree())
+			check_reference_items(items);
+	}
+
+	for (DataBindTextureKey &texture_key : texture_keys) {
+		if (!is_quarantined(texture_key.status) and texture_key.node->is_visible_in_tree())
+			check_reference_texture_key(texture_key);
+	}
+
+	for (DataBindBatch &batch : datamodel_batches) {
+		if (!is_quarantined(batch.status) and batch.node->is_visible_in_tree())
+			check_reference_batch(batch);
+	}
+}
+
+template <typename T> void DataBind::check_reference_group(uint32_t property_id, DataBindGroup<T> &group) {
+	const StringName property = properties[property_id].property;
+	for (uint32_t i = 0; i < group.size(); ++i) {
+		Control *node = group.nodes[i];
+		if (is_quarantined(group.status[i]) or (property_id != VISIBLE and !node->is_visible_in_tree()))
+			continue;
+
+		Variant result;
+		if (execute(group.callables[i], group.setters[i], result) != FAILURE_NONE)
+			continue; // Failures are reported by update
+
+		const Variant actual = node->get(property);
+		call_setter(node, group.setters[i].method, result);
+		group.values[i] = result;
+		report_divergence(group.status[i].id, node, property, actual, node->get(property), group.tags[i] != 0);
+	}
+}
+
+// Formats a text_format argument into a String instead of the reused buffer of append_value.
+static String get_reference_text(const Variant &p_value, uint8_t p_decimals) {
+	if (p_value.get_type() == Variant::NIL)
+		return String();
+	if (p_value.get_type() != Variant::FLOAT)
+		return p_value.stringify();
+
+	char text[FLOAT_TEXT_SIZE];
+	format_float(text, p_value, p_decimals);
+	return String(text);
+}
+
+void DataBind::check_reference_text_format(DataBindTextFormat &text_format) {
+	String text;
+	for (const DataBindTextSegment &segment : text_format.segments) {
+		text += segment.literal;
+		if (segment.arg == -1)
+			continue;
+
+		Variant value;
+		if (!get_value(text_format.args[segment.arg], value))
+			return;
+		text += get_reference_text(value, segment.decimals);
+	}
+
+	const Variant actual = text_format.node->get(SNAME("text"));
+	call_setter(text_format.node, text_format.setter, text);
+	text_format.rendered.clear(); // The next update sets the text again with the optimised path
+	report_divergence(text_format.status.id, text_format.node, SNAME("text_format"), actual, text_format.node->get(SNAME("text")), text_format.tags != 0);
+}
+
+void DataBind::check_reference_tr_text(DataBindTrText &tr_text) {
+	Variant key = tr_text.key;
+	if (tr_text.key_getter.is_valid() and !get_value(tr_text.key_getter, key))
+		return;
+
+	Array arg_values;
+	for (const DataBindGetter &arg : tr_text.args) {
+		Variant value;
+		if (!get_value(arg, value))
+			return;
+		arg_values.push_back(value);
+	}
+
+	String text = tr(key);
+	if (!arg_values.is_empty())
+		text = text.format(arg_values);
+
+	const StringName property = properties[tr_text.property].property;
+	const Variant actual = tr_text.node->get(property);
+	call_setter(tr_text.node, tr_text.setter, text);
+	tr_text.text = text;
+	report_divergence(tr_text.status.id, tr_text.node, property, actual, tr_text.node->get(property), tr_text.tags != 0);
+}
+
+void DataBind::check_reference_texture_key(DataBindTextureKey &texture_key) {
+	Variant key;
+	if (!get_value(texture_key.getter, key) or key.get_type() == Variant::NIL)
+		return;
+
+	const Ref<Texture2D> texture = resolve_texture(key);
+	const StringName property = properties[texture_key.property].property;
+	const Variant actual = texture_key.node->get(property);
+	call_setter(texture_key.node, texture_key.setter, texture);
+	texture_key.key = key;
+	report_divergence(texture_key.status.id, texture_key.node, property, actual, texture_key.node->get(property), texture_key.tags != 0);
+}
+
+void DataBind::check_reference_batch(DataBindBatch &batch) {
+	Variant result;
+	if (!get_value(batch.getter, result) or !result.is_array())
+		return;
+
+	if (batch.rebuild)
+		resolve_batch_targets(batch);
+
+	const Array values = result;
+	const StringName property = properties[batch.property_id].property;
+	const uint32_t count = MIN(uint32_t(values.size()), batch.targets.size());
+	for (uint32_t i = 0; i < count; ++i) {
+		DataBindBatchTarget &target = batch.targets[i];
+		Control *node = Object::cast_to<Control>(ObjectDB::get_instance(target.id));
+		if (node == nullptr or !node->is_visible_in_tree())
+			continue;
+
+		const Variant actual = node->get(property);
+		call_setter(node, target.setter, get_batch_value(target.type, values[i]));
+		target.value = values[i];
+		report_divergence(batch.status.id, node, property, actual, node->get(property), batch.tags != 0);
+	}
+}
+
+// Items are only compared, setting them again would make the item cache diverge from the node.
+void DataBind::check_reference_items(DataBindItems &items) {
+	Variant result;
+	if (!get_value(items.getter, result) or result.get_type() != Variant::ARRAY)
+		return;
+
+	const Array descriptors = result;
+	const int count = items.node->call(SNAME("get_item_count"));
+	if (count != descriptors.size()) {
+		report_divergence(items.status.id, items.node, SNAME("items"), count, descriptors.size(), items.tags != 0);
+		return;
+	}
+
+	for (int i = 0; i < count; ++i) {
+		const Variant &descriptor = descriptors[i];
+		const String text = descriptor.get_type() == Variant::DICTIONARY ? String(Dictionary(descriptor).get("text", String())) : descriptor.stringify();
+		const String actual = items.node->call(SNAME("get_item_text"), i);
+		if (actual != text) {
+			report_divergence(items.status.id, items.node, "items[" + itos(i) + "].text", actual, text, items.tags != 0);
+			return;
+		}
+	}
+}
+
+void DataBind::report_divergence(uint32_t id, Control *node, const String &property, const Variant &actual, const Variant &expected, bool tagged) {
+	if (actual == expected)
+		return;
+
+	Dictionary divergence;
+	divergence["path"] = node->get_path();
+	divergence["property"] = property;
+	divergence["actual"] = actual;
+	divergence["expected"] = expected;
+	divergence["tagged"] = tagged;
+	reference_divergences.push_back(divergence);
+
+	// Only the first divergence of a binding is printed, get_reference_divergences has the divergences of the last check.
+	if (reported_divergences.has(id))
+		return;
+
+	reported_divergences.insert(id);
+	print_error(vformat("DataBind reference check: %s of %s is %s, expected %s.%s", property, node->get_path(), actual, expected, tagged ? " The binding is tagged, is an invalidate missing?" : ""));
+}
+
+void DataBind::set_reference_check_interval(uint32_t p_frames) { reference_check_interval = p_frames; }
+
+uint32_t DataBind::get_reference_check_interval() const { return reference_check_interval; }
+
+TypedArray<Dictionary> DataBind::get_reference_divergences() const { return reference_divergences; }
+
+Error DataBind::start_trace(const String &p_path) {
+	ERR_FAIL_COND_V_MSG(get_scene_file_path().is_empty(), ERR_UNCONFIGURED, "Only DataBinds that were instantiated from a scene can be traced.");
+
+	trace = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(trace.is_null(), ERR_CANT_CREATE, "Can't create DataBind trace: " + p_path);
+
+	trace->store_32(TRACE_MAGIC);
+	trace->store_32(TRACE_VERSION);
+	trace->store_pascal_string(get_scene_file_path());
+	return OK;
+}
+
+void DataBind::stop_trace() { trace.unref(); }
+
+// Objects can't be stored in a trace, Resources are stored as their path and everything else as a hash.
+void DataBind::trace_binding(uint32_t id, const Variant &value, uint64_t usec, bool applied) {
+	uint8_t flags = applied ? TRACE_APPLIED : 0;
+	Variant stored = value;
+	if (value.get_type() == Variant::OBJECT) {
+		const Resource *resource = Object::cast_to<Resource>(value);
+		if (resource != nullptr and !resource->get_path().is_empty()) {
+			flags |= TRACE_RESOURCE;
+			stored = resource->get_path();
+		} else {
+			flags |= TRACE_HASH;
+			stored = int64_t(value.hash());
+		}
+	}
+
+	int length = 0;
+	ERR_FAIL_COND(encode_variant(stored, nullptr, length) != OK);
+	trace_buffer.resize(length);
+	encode_variant(stored, trace_buffer.ptr(), length);
+
+	trace->store_8(TRACE_BINDING);
+	trace->store_32(id);
+	trace->store_32(MIN(usec, uint64_t(UINT32_MAX)));
+	trace->store_8(flags);
+	trace->store_32(length);
+	trace->store_buffer(trace_buffer.ptr(), length);
+}
+
+void DataBind::replay_binding(const DataBindRef &ref, const Variant &value) {
+	if (ref.table >= TABLE_GROUPS) {
+		const uint32_t property_id = (ref.table - TABLE_GROUPS) / 2;
+		if ((ref.table - TABLE_GROUPS) % 2 == 0)
+			apply_group_value(property_id, callable_groups[property_id], ref.index, value);
+		else
+			apply_group_value(property_id, expression_groups[property_id], ref.index, value);
+		return;
+	}
+
+	switch (ref.table) {
+		case TABLE_TEXT_FORMAT: {
+			queue_set(text_formats[ref.index].node, text_formats[ref.index].setter, value);
+		} break;
+		case TABLE_TR_TEXT: {
+			queue_set(tr_texts[ref.index].node, tr_texts[ref.index].setter, value);
+		} break;
+		case TABLE_ITEMS: {
+			apply_items(item_lists[ref.index], value);
+		} break;
+		case TABLE_PROGRESS: {
+			progress_bars[ref.index].node->set_value_no_signal(value);
+		} break;
+		case TABLE_TWO_WAY: {
+			queue_set(two_ways[ref.index].node, two_ways[ref.index].setter, value);
+		} break;
+		case TABLE_TEXTURE_KEY: {
+			queue_set(texture_keys[ref.index].node, texture_keys[ref.index].setter, value);
+		} break;
+		case TABLE_DATAMODEL_BATCH: {
+			apply_batch(datamodel_batches[ref.index], value);
+		} break;
+	}
+}
+
+Dictionary DataBind::replay_trace(const String &p_path) {
+	Dictionary stats;
+	const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(file.is_null(), stats, "Can't open DataBind trace: " + p_path);
+	ERR_FAIL_COND_V_MSG(file->get_32() != TRACE_MAGIC or file->get_32() != TRACE_VERSION, stats, p_path + " is not a DataBind trace.");
+
+	SceneTree *tree = SceneTree::get_singleton();
+	ERR_FAIL_NULL_V_MSG(tree, stats, "Replaying a DataBind trace needs a SceneTree.");
+
+	const String scene_path = file->get_pascal_string();
+	DataBind *databind = Object::cast_to<DataBind>(init_scene(scene_path));
+	ERR_FAIL_NULL_V_MSG(databind, stats, "Failed to init DataBind scene: " + scene_path);
+
+	// Register the bindings without running any of them, the results come from the trace.
+	databind->replaying = true;
+	databind->init_databind();
+	// Disabled so neither the DataBind update nor the process callbacks of a subclass or script run, they would read game state that
+	// doesn't exist in a replay. NOTIFICATION_READY can't be suppressed and still runs.
+	databind->set_physics_process(false);
+	databind->set_process_mode(PROCESS_MODE_DISABLED);
+	tree->get_root()->add_child(databind);
+	MessageQueue::get_singleton()->flush();
+
+	HashMap<uint32_t, DataBindRef> bindings;
+	for (const KeyValue<Control *, DataBindRegisteredNode> &registered : databind->registered_nodes) {
+		for (const DataBindRef &ref : registered.value.refs)
+			bindings.insert(databind->get_binding_id(ref.table, ref.index), ref);
+	}
+
+	uint64_t updates = 0;
+	uint64_t records = 0;
+	uint64_t applied = 0;
+	uint64_t skipped = 0;
+	uint64_t recorded_usec = 0;
+	uint64_t replay_usec = 0;
+	uint64_t max_update_usec = 0;
+	uint64_t layout_passes = 0;
+	uint64_t update_usec = 0;
+	LocalVector<uint8_t> buffer;
+
+	// Only the setters and the layout passes they cause are timed, reading the trace is not.
+	const auto finish_update = [&]() {
+		if (updates == 0)
+			return;
+
+		const uint64_t start = OS::get_singleton()->get_ticks_usec();
+		databind->apply_pending_sets();
+		MessageQueue::get_singleton()->flush();
+		update_usec += OS::get_singleton()->get_ticks_usec() - start;
+		replay_usec += update_usec;
+		max_update_usec = MAX(max_update_usec, update_usec);
+		layout_passes += databind->layout_passes;
+	};
+
+	while (file->get_position() < file->get_length()) {
+		const uint8_t type = file->get_8();
+		if (type == TRACE_UPDATE) {
+			finish_update();
+			updates++;
+			databind->layout_passes = 0;
+			update_usec = 0;
+			continue;
+		}
+
+		ERR_BREAK_MSG(type != TRACE_BINDING, p_path + " is corrupted.");
+		const uint32_t id = file->get_32();
+		recorded_usec += file->get_32();
+		const uint8_t flags = file->get_8();
+		const uint32_t length = file->get_32();
+		buffer.resize(length);
+		ERR_BREAK_MSG(file->get_buffer(buffer.ptr(), length) != length, p_path + " is truncated.");
+		records++;
+
+		const DataBindRef *ref = bindings.getptr(id);
+		if (!(flags & TRACE_APPLIED))
+			continue;
+		if (ref == nullptr or (flags & TRACE_HASH)) {
+			skipped++;
+			continue;
+		}
+
+		Variant value;
+		ERR_CONTINUE(decode_variant(value, buffer.ptr(), length) != OK);
+		if (flags & TRACE_RESOURCE)
+			value = ResourceLoader::load(value);
+
+		const uint64_t start = OS::get_singleton()->get_ticks_usec();
+		databind->replay_binding(*ref, value);
+		update_usec += OS::get_singleton()->get_ticks_usec() - start;
+		applied++;
+	}
+	finish_update();
+
+	tree->get_root()->remove_child(databind);
+	memdelete(databind);
+
+	stats["scene"] = scene_path;
+	stats["updates"] = updates;
+	stats["records"] = records;
+	stats["applied"] = applied;
+	stats["skipped"] = skipped;
+	stats["recorded_usec"] = recorded_usec;
+	stats["replay_usec"] = replay_usec;
+	stats["max_update_usec"] = max_update_usec;
+	stats["layout_passes"] = layout_passes;
+	return stats;
+}
+
+Dictionary DataBind::benchmark_expression(const String &p_expression, Object *p_base, uint32_t p_iterations) {
+	Dictionary stats;
+	ERR_FAIL_NULL_V(p_base, stats);
+
+	Ref<DataBindExpression> compiled;
+	compiled.instantiate();
+	ERR_FAIL_COND_V_MSG(compiled->parse(p_expression, p_base) != OK, stats, compiled->get_error_text());
+
+	Ref<Expression> expression;
+	expression.instantiate();
+	ERR_FAIL_COND_V_MSG(expression->parse(p_expression) != OK, stats, expression->get_error_text());
+
+	const Array inputs;
+	Variant compiled_result;
+	Variant expression_result;
+
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t i = 0; i < p_iterations; ++i)
+		compiled->execute(p_base, compiled_result);
+	const uint64_t compiled_usec = OS::get_singleton()->get_ticks_usec() - start;
+
+	start = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t i = 0; i < p_iterations; ++i)
+		expression_result = expression->execute(inputs, p_base, false);
+	const uint64_t expression_usec = OS::get_singleton()->get_ticks_usec() - start;
+
+	stats["compiled"] = compiled->is_compiled();
+	stats["iterations"] = p_iterations;
+	stats["compiled_usec"] = compiled_usec;
+	stats["expression_usec"] = expression_usec;
+	stats["results_match"] = compiled_result == expression_result;
+	return stats;
+}
+
+Dictionary DataBind::get_memory_footprint() const {
+	uint64_t bindings = 0;
+	uint64_t bytes = 0;
+	for (uint32_t property_id = 0; property_id < callable_groups.size(); ++property_id) {
+		bindings += callable_groups[property_id].size() + expression_groups[property_id].size();
+		bytes += callable_groups[property_id].get_memory_usage() + expression_groups[property_id].get_memory_usage();
+		bytes += uint64_t(expression_groups[property_id].size()) * sizeof(DataBindExpression);
+	}
+
+	bindings += text_formats.size() + tr_texts.size();
+	bytes += uint64_t(text_formats.size()) * sizeof(DataBindTextFormat) + uint64_t(tr_texts.size()) * sizeof(DataBindTrText);
+	for (const DataBindTextFormat &text_format : text_formats)
+		bytes += text_format.segments.size() * sizeof(DataBindTextSegment) + text_format.args.size() * sizeof(DataBindGetter) + (text_format.buffer.size() + text_format.rendered.size()) * sizeof(char32_t);
+	for (const DataBindTrText &tr_text : tr_texts)
+		bytes += tr_text.args.size() * (sizeof(DataBindGetter) + sizeof(Variant));
+
+	bindings += two_ways.size();
+	bytes += uint64_t(two_ways.size()) * sizeof(DataBindTwoWay);
+
+	bindings += datamodel_batches.size();
+	for (const DataBindBatch &batch : datamodel_batches)
+		bytes += sizeof(DataBindBatch) + batch.targets.size() * sizeof(DataBindBatchTarget);
+
+	bindings += texture_keys.size();
+	bytes += uint64_t(texture_keys.size()) * sizeof(DataBindTextureKey);
+
+	bindings += progress_bars.size();
+	bytes += uint64_t(progress_bars.size()) * sizeof(DataBindProgress);
+
+	bindings += item_lists.size();
+	for (const DataBindItems &items : item_lists)
+		bytes += sizeof(DataBindItems) + items.items.size() * sizeof(DataBindItem);
+
+	for (const DataBindPressed &pressed : pressed_buttons)
+		bytes += sizeof(DataBindPressed) + (pressed.expression.is_valid() ? sizeof(DataBindExpression) : 0);
+
+	for (const KeyValue<Control *, DataBindRegisteredNode> &registered : registered_nodes)
+		bytes += sizeof(Control *) + sizeof(DataBindRegisteredNode) + registered.value.refs.size() * sizeof(DataBindRef);
+
+	Dictionary footprint;
+	footprint["bindings"] = bindings;
+	footprint["bytes"] = bytes;
+	return footprint;
+}
+
+Dictionary DataBind::get_report() const {
+	Dictionary report;
+	report["path"] = is_inside_tree() ? String(get_path()) : String(get_name());
+	report["class"] = base_instance != nullptr ? base_instance->get_class() : get_class();
+	report["scene"] = get_scene_file_path();
+	report["nodes"] = registered_nodes.size();
+
+	// Bindings of registered properties, split into Callables and Expressions. Compiled Expressions don't go through godot's Expression.
+	Dictionary bindings;
+	uint32_t callables = 0;
+	uint32_t expressions = 0;
+	uint32_t compiled = 0;
+	for (uint32_t property_id = 0; property_id < callable_groups.size(); ++property_id) {
+		const DataBindGroup<Ref<DataBindExpression>> &group = expression_groups[property_id];
+		if (callable_groups[property_id].size() == 0 and group.size() == 0)
+			continue;
+
+		Dictionary property;
+		property["callables"] = callable_groups[property_id].size();
+		property["expressions"] = group.size();
+		bindings[properties[property_id].meta] = property;
+
+		callables += callable_groups[property_id].size();
+		expressions += group.size();
+		for (const Ref<DataBindExpression> &expression : group.callables)
+			compiled += expression->is_compiled();
+	}
+
+	bindings["text_format"] = text_formats.size();
+	bindings["tr_text"] = tr_texts.size();
+	bindings["items"] = item_lists.size();
+	bindings["progress_rate"] = progress_bars.size();
+	bindings["two_way"] = two_ways.size();
+	bindings["texture_key"] = texture_keys.size();
+	bindings["datamodel_batch"] = datamodel_batches.size();
+	bindings["pressed"] = pressed_buttons.size();
+	report["bindings"] = bindings;
+	report["callables"] = callables;
+	report["expressions"] = expressions;
+	report["compiled_expressions"] = compiled;
+
+	const Dictionary footprint = get_memory_footprint();
+	report["binding_count"] = footprint["bindings"];
+	report["binding_bytes"] = footprint["bytes"];
+	report["arena"] = get_arena_stats();
+
+	// Datamodels and the DataBinds they instantiated, the children report themselves in get_reports.
+	Array datamodels;
+	for (const ObjectID &id : datamodel_nodes) {
+		const Control *node = Object::cast_to<Control>(ObjectDB::get_instance(id));
+		if (node == nullptr)
+			continue;
+
+		// The DataBind of a datamodel item isn't necessarily its root, PlanetView's items are PanelContainers with the DataBind inside.
+		Array children;
+		for (int i = 0; i < node->get_child_count(); ++i) {
+			Node *item = node->get_child(i);
+			if (Object::cast_to<DataBind>(item) != nullptr) {
+				children.push_back(String(item->get_path()));
+				continue;
+			}
+
+			const TypedArray<Node> databinds = item->find_children("*", "DataBind", true, false);
+			if (!databinds.is_empty())
+				children.push_back(String(Object::cast_to<Node>(databinds[0])->get_path()));
+		}
+
+		Dictionary datamodel;
+		datamodel["path"] = String(node->get_path());
+		datamodel["getter"] = node->get_meta("datamodel");
+		datamodel["children"] = children;
+		datamodels.push_back(datamodel);
+	}
+	report["datamodels"] = datamodels;
+
+	report["quarantined"] = get_quarantined_bindings().size();
+	report["last_update_usec"] = last_update_usec;
+	report["layout_passes"] = last_layout_passes;
+	return report;
+}
+
+TypedArray<Dictionary> DataBind::get_reports() {
+	TypedArray<Dictionary> reports;
+	for (const DataBind *databind : instances)
+		reports.push_back(databind->get_report());
+	return reports;
+}
+
+Error DataBind::dump_reports(const String &p_path) {
+	Error err;
+	const Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, "Can't open DataBind report file " + p_path + ".");
+
+	Dictionary dump;
+	dump["frames"] = Engine::get_singleton()->get_physics_frames();
+	dump["databinds"] = get_reports();
+	file->store_string(JSON::stringify(dump, "\t"));
+	return OK;
+}
+
+void DataBind::_bind_methods() {
+	ClassDB::bind_static_method("DataBind", D_METHOD("init", "path"), &DataBind::init);
+	ClassDB::bind_static_method("DataBind", D_METHOD("invalidate", "tag"), &DataBind::invalidate);
+	ClassDB::bind_static_method("DataBind", D_METHOD("register_property", "meta", "property"), &DataBind::register_property);
+	ClassDB::bind_static_method("DataBind", D_METHOD("set_texture_resolver", "resolver"), &DataBind::set_texture_resolver);
+	ClassDB::bind_static_method("DataBind", D_METHOD("clear_texture_cache"), &DataBind::clear_texture_cache);
+	ClassDB::bind_method(D_METHOD("get_memory_footprint"), &DataBind::get_memory_footprint);
+	ClassDB::bind_method(D_METHOD("get_arena_stats"), &DataBind::get_arena_stats);
+	ClassDB::bind_method(D_METHOD("get_report"), &DataBind::get_report);
+	ClassDB::bind_static_method("DataBind", D_METHOD("get_reports"), &DataBind::get_reports);
+	ClassDB::bind_static_method("DataBind", D_METHOD("dump_reports", "path"), &DataBind::dump_reports);
+	ClassDB::bind_method(D_METHOD("set_reference_check_interval", "frames"), &DataBind::set_reference_check_interval);
+	ClassDB::bind_method(D_METHOD("get_reference_check_interval"), &DataBind::get_reference_check_interval);
+	ClassDB::bind_method(D_METHOD("get_reference_divergences"), &DataBind::get_reference_divergences);
+	ClassDB::bind_method(D_METHOD("start_trace", "path"), &DataBind::start_trace);
+	ClassDB::bind_method(D_METHOD("stop_trace"), &DataBind::stop_trace);
+	ClassDB::bind_static_method("DataBind", D_METHOD("replay_trace", "path"), &DataBind::replay_trace);
+	ClassDB::bind_static_method("DataBind", D_METHOD("benchmark_expression", "expression", "base", "iterations"), &DataBind::benchmark_expression);
+	ClassDB::bind_method(D_METHOD("get_layout_passes"), &DataBind::get_layout_passes);
+	ClassDB::bind_method(D_METHOD("get_quarantined_bindings"), &DataBind::get_quarantined_bindings);
+}
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "DataBindArena.hpp"
+#include "DataBindExpression.hpp"
+#include "DataBindSnapshot.hpp"
+
+#include "core/io/file_access.h"
 #include "core/math/expression.h"
+#include "core/templates/hash_set.h"
 
 #include "scene/gui/control.h"
+#include "scene/gui/range.h"
+#include "scene/resources/texture.h"
 
 #define create_databind(m_class, m_scene) Object::cast_to<m_class>(DataBind::init(m_scene))
 
@@ -12,6 +20,7 @@ class DataBind : public Control {
 	GDCLASS(DataBind, Control)
 
 private:
+	// Ids of the built in properties in the property registry, they are registered first and in this order so visible is always updated first.
 	enum DataBindProperty : uint8_t {
 		VISIBLE,
 		DISABLED,
@@ -20,51 +29,504 @@ private:
 		ICON,
 		TOOLTIP,
 		PROGRESS,
+		PROPERTY_BUILTIN_MAX,
+	};
+
+	// Ids of the tables bindings are stored in, every registered property has a callable_groups and an expression_groups table after TABLE_GROUPS.
+	enum DataBindTable : uint16_t {
+		TABLE_TEXT_FORMAT,
+		TABLE_TR_TEXT,
+		TABLE_PRESSED,
+		TABLE_ITEMS,
+		TABLE_PROGRESS,
+		TABLE_TWO_WAY,
+		TABLE_TEXTURE_KEY,
+		TABLE_DATAMODEL_BATCH,
+		TABLE_GROUPS,
+	};
+
+	// Setter of a property resolved for one Control class.
+	struct DataBindSetter {
+		MethodBind *method{}; // nullptr if the class doesn't have the property
+		Variant::Type type = Variant::NIL; // NIL accepts any type
+		StringName class_name; // Class the result has to be if type is OBJECT
+	};
+
+	// Metadata key that can be bound to a Control property. Built in properties have a fixed setter and type, every other property is
+	// resolved through ClassDB the first time it is bound on a Control class.
+	struct DataBindPropertyInfo {
+		StringName meta;
+		StringName property; // Read back by the reference check
+		StringName setter; // Empty to use the ClassDB setter of property
+		Variant::Type type = Variant::NIL;
+		StringName class_name;
+		HashMap<StringName, DataBindSetter> setters; // Resolved setter of every Control class the property was bound on
+	};
+
+	enum DataBindFailure : uint8_t {
+		FAILURE_NONE,
+		FAILURE_MISSING_METHOD,
+		FAILURE_EXECUTE,
+		FAILURE_TYPE,
+		FAILURE_CLASS,
+	};
+
+	// A trace is a header (TRACE_MAGIC, TRACE_VERSION, scene path) followed by a TRACE_UPDATE record for every update
+	// and a TRACE_BINDING record (id, usec, flags, encoded value) for every binding that was executed during it.
+	enum DataBindTraceRecord : uint8_t {
+		TRACE_UPDATE,
+		TRACE_BINDING,
+	};
+
+	enum DataBindTraceFlags : uint8_t {
+		TRACE_APPLIED = 1, // The value changed and was passed to the setter
+		TRACE_RESOURCE = 2, // The value is the path of a Resource
+		TRACE_HASH = 4, // The value is the hash of an Object that can't be replayed
+	};
+
+	static constexpr uint32_t TRACE_MAGIC = 0x52544244; // DBTR
+	static constexpr uint32_t TRACE_VERSION = 1;
+
+	// Bindings that fail QUARANTINE_FAILURES times in a row are skipped for QUARANTINE_FRAMES physics frames, doubled for every quarantine in a row.
+	static constexpr uint8_t QUARANTINE_FAILURES = 8;
+	static constexpr uint32_t QUARANTINE_FRAMES = 60;
+	static constexpr uint32_t QUARANTINE_MAX_BACKOFF = 6;
+
+	struct DataBindStatus {
+		uint32_t id{};
+		uint32_t retry_frame{}; // Quarantined until this frame
+		uint8_t failures{}; // Failures in a row
+	};
+
+	// Only exists for bindings that failed at least once.
+	struct DataBindError {
+		NodePath path; // The Control can be freed before the error is removed on the next update
+		StringName property;
+		uint32_t failures{};
+		uint32_t quarantines{}; // Quarantines in a row
+		uint32_t retry_frame{};
+		String message; // First failure
+	};
+
+	// Location of a binding so it can be removed without searching when its Control leaves the DataBind.
+	struct DataBindRef {
+		uint16_t table{};
+		uint32_t index{};
+	};
+
+	struct DataBindRegisteredNode {
+		ObjectID id; // Detects a freed Control whose address got reused
+		ArenaVector<DataBindRef> refs;
+	};
+
+	struct DataBindExitedNode {
+		Control *node{};
+		ObjectID id;
+	};
+
+	// All properties of one registered property that are executed the same way (Callable or Expression).
+	// Stored as parallel arrays so update() is a tight loop over each group instead of chasing a vector per node.
+	template <typename T> struct DataBindGroup {
+		ArenaVector<Control *> nodes;
+		ArenaVector<T> callables;
+		ArenaVector<DataBindSetter> setters;
+		ArenaVector<uint64_t> tags; // Bitset of tag_bits, 0 means the property is polled every update.
+		ArenaVector<bool> dirty;
+		ArenaVector<Variant> values; // Last result that was set on the node, the setter is skipped if the result didn't change.
+		ArenaVector<DataBindStatus> status;
+
+		void set_arena(DataBindArena *p_arena) {
+			nodes.set_arena(p_arena);
+			callables.set_arena(p_arena);
+			setters.set_arena(p_arena);
+			tags.set_arena(p_arena);
+			dirty.set_arena(p_arena);
+			values.set_arena(p_arena);
+			status.set_arena(p_arena);
+		}
+
+		_FORCE_INLINE_ uint32_t size() const { return nodes.size(); }
+		_FORCE_INLINE_ uint64_t get_memory_usage() const { return uint64_t(size()) * (sizeof(Control *) + sizeof(T) + sizeof(DataBindSetter) + sizeof(uint64_t) + sizeof(bool) + sizeof(Variant) + sizeof(DataBindStatus)); }
+
+		uint32_t push_back(Control *p_node, const T &p_callable, const DataBindSetter &p_setter, uint64_t p_tags, uint32_t p_id) {
+			DataBindStatus binding_status;
+			binding_status.id = p_id;
+			status.push_back(binding_status);
+			nodes.push_back(p_node);
+			callables.push_back(p_callable);
+			setters.push_back(p_setter);
+			tags.push_back(p_tags);
+			dirty.push_back(true);
+			values.push_back(Variant());
+			return size() - 1;
+		}
+
+		// Swap remove, returns the node that was moved into p_index or nullptr if p_index was the last element.
+		Control *remove_at(uint32_t p_index) {
+			nodes.remove_at_unordered(p_index);
+			callables.remove_at_unordered(p_index);
+			setters.remove_at_unordered(p_index);
+			tags.remove_at_unordered(p_index);
+			dirty.remove_at_unordered(p_index);
+			values.remove_at_unordered(p_index);
+			status.remove_at_unordered(p_index);
+			return p_index < size() ? nodes[p_index] : nullptr;
+		}
+	};
+
+	struct DataBindPressed {
+		Control *node{};
+		Callable callable; // Connected to the pressed signal
+		Ref<DataBindExpression> expression; // need to take ownership or signals won't work
+	};
+
+	// Method or Expression that is executed on base_instance to get a value.
+	struct DataBindGetter {
+		MethodBind *method{};
+		Ref<DataBindExpression> expression;
+
+		_FORCE_INLINE_ bool is_valid() const { return method != nullptr or expression.is_valid(); }
+	};
+
+	// Literal text followed by an optional argument of a text_format template.
+	struct DataBindTextSegment {
+		String literal;
+		int8_t arg = -1; // -1 if the segment is only literal text
+		uint8_t decimals{};
 	};
 
-	struct DataBindExpressionProperty {
-		DataBindProperty property_type{};
-		Ref<Expression> callable;
+	struct DataBindTextFormat {
+		Control *node{};
+		DataBindStatus status;
+		MethodBind *setter{}; // set_text
+		bool dirty = true;
+		uint64_t tags{};
+		TightLocalVector<DataBindTextSegment> segments;
+		TightLocalVector<DataBindGetter> args;
+		LocalVector<char32_t> buffer; // Text rendered this update, reused so steady state updates don't allocate.
+		LocalVector<char32_t> rendered; // Text that was last set on the node.
+	};
+
+	struct DataBindTrText {
+		Control *node{};
+		DataBindStatus status;
+		DataBindProperty property{}; // TEXT or TOOLTIP
+		MethodBind *setter{};
+		bool dirty = true;
+		bool translation_changed = true;
+		uint64_t tags{};
+		Variant key; // Translation key, set every update if key_getter is valid
+		DataBindGetter key_getter;
+		TightLocalVector<DataBindGetter> args;
+		Array arg_values; // Args used to format text
+		String text; // Cached translated and formatted text
+	};
+
+	// Last state applied to one item of an ItemList or OptionButton.
+	struct DataBindItem {
+		String text;
+		Ref<Texture2D> icon;
+		String tooltip;
+		bool disabled = false;
+		Variant metadata;
+	};
+
+	struct DataBindItems {
+		Control *node{};
+		DataBindStatus status;
+		bool dirty = true;
+		uint64_t tags{};
+		DataBindGetter getter;
+		LocalVector<DataBindItem> items;
+	};
+
+	// progress binding with a progress_rate, the getter is only sampled every progress_rate seconds and the bar is interpolated to the
+	// new value on the render frames until the next sample.
+	struct DataBindProgress {
+		Range *node{};
+		DataBindStatus status;
+		bool dirty = true;
+		bool sampled = false;
+		uint64_t tags{};
+		DataBindGetter getter;
+		uint32_t rate_frames{}; // Physics frames between samples
+		uint32_t next_sample_frame{};
+		double duration{}; // progress_rate in seconds
+		double snap{}; // Jump to the new value if it is at least this far from the displayed value, 0 never snaps.
+		double from{};
+		double to{};
+		double elapsed{}; // Interpolation is done when elapsed reaches duration.
+	};
+
+	// Input Control that is read from two_way and writes changes made by the user back with two_way_write.
+	struct DataBindTwoWay {
+		Control *node{};
+		DataBindStatus status;
+		bool dirty = true;
+		bool editing = false; // Focused LineEdit or SpinBox, or dragged Slider. Reads are skipped while editing.
+		bool write_pending = false;
+		uint64_t tags{};
+		DataBindGetter getter;
+		MethodBind *write{};
+		MethodBind *setter{}; // Setter that doesn't emit changed_signal
+		Variant value; // Last value that was read or written
+		Variant pending; // Latest value from the Control, written on the next update
+		StringName changed_signal;
+		Callable changed;
+		Object *edit_source{}; // Object that emits the editing signals, nullptr if the Control has none
+		StringName edit_started_signal;
+		StringName edit_ended_signal;
+		Callable edit_started;
+		Callable edit_ended;
+	};
+
+	// texture_key or icon_key binding, the getter returns a key that is resolved to a texture through the shared texture cache and the
+	// texture is only set when the key changes.
+	struct DataBindTextureKey {
+		Control *node{};
+		DataBindStatus status;
+		DataBindProperty property{}; // TEXTURE or ICON
+		MethodBind *setter{};
+		bool dirty = true;
+		uint64_t tags{};
+		DataBindGetter getter;
+		Variant key; // Key of the texture that was last set
 	};
 
-	struct DataBindCallableProperty {
-		DataBindProperty property_type{};
-		MethodBind *callable{};
+	// Control in one datamodel child that a datamodel_batch binding sets.
+	struct DataBindBatchTarget {
+		ObjectID id; // Null if the child doesn't have the Control or the Control doesn't have the property
+		MethodBind *setter{};
+		Variant::Type type = Variant::NIL;
+		Variant value; // Last element that was set
 	};
 
-	struct DataBindNode {
+	// datamodel_batch binding, one getter returns an array for all children of a datamodel and element i is set on child i.
+	struct DataBindBatch {
+		Control *node{}; // Control with the datamodel
+		DataBindStatus status;
+		bool dirty = true;
+		bool rebuild = true; // Children changed since the targets were resolved
+		uint64_t tags{};
+		uint32_t property_id{};
+		NodePath path; // Path of the Control in every child
+		DataBindGetter getter;
+		LocalVector<DataBindBatchTarget> targets;
+	};
+
+	struct DataBindPendingSet {
 		Control *node{};
-		TightLocalVector<DataBindExpressionProperty> expression_properties;
-		TightLocalVector<DataBindCallableProperty> callable_properties;
+		MethodBind *setter{};
+		Variant value;
 	};
 
-	TightLocalVector<DataBindNode> nodes;
-	TightLocalVector<Ref<Expression>> pressed_expressions;
+	// Owns the binding tables and Expressions, declared first so it is destroyed after everything that allocated from it.
+	DataBindArena arena;
+	LocalVector<DataBindGroup<MethodBind *>> callable_groups; // One group for every registered property
+	LocalVector<DataBindGroup<Ref<DataBindExpression>>> expression_groups;
+	ArenaVector<DataBindPressed> pressed_buttons;
+	ArenaVector<DataBindTextFormat> text_formats;
+	ArenaVector<DataBindTrText> tr_texts;
+	ArenaVector<DataBindItems> item_lists;
+	ArenaVector<DataBindProgress> progress_bars;
+	ArenaVector<DataBindTwoWay> two_ways;
+	ArenaVector<DataBindTextureKey> texture_keys;
+	ArenaVector<DataBindBatch> datamodel_batches;
+	HashMap<Control *, DataBindRegisteredNode> registered_nodes; // Every Control in the subtree of this DataBind, with or without bindings.
+	LocalVector<DataBindExitedNode> exited_nodes;
+	HashSet<ObjectID> datamodel_nodes; // Datamodels are only instantiated the first time their Control is registered.
+	LocalVector<DataBindPendingSet> pending_sets; // Setters of the current update, reused every update
+	HashMap<uint32_t, DataBindError> errors;
+	uint32_t next_binding_id{};
+	uint32_t pending_writes{}; // two_ways with write_pending
+	uint32_t frame{};
+	uint32_t layout_passes{};
+	uint32_t last_layout_passes{};
+	uint64_t last_update_usec{}; // Time the update of the last physics frame took
 	Object *base_instance{};
+	DataBindSnapshotSource *snapshot_source{}; // Not owned
+	uint32_t reference_check_interval{}; // Physics frames between reference checks, 0 disables them.
+	TypedArray<Dictionary> reference_divergences; // Divergences of the last reference check
+	HashSet<uint32_t> reported_divergences;
+	Ref<FileAccess> trace;
+	LocalVector<uint8_t> trace_buffer; // Encoded value of the current record, reused for every record
+	Variant trace_value; // Value applied by the row that is currently updated
+	bool trace_applied = false;
+	bool replaying = false; // Bindings are registered but never executed, their results come from a trace
+	uint64_t dirty_tags{}; // Tags invalidated since the last update.
+
+	static LocalVector<DataBind *> instances;
+	static HashMap<StringName, uint8_t> tag_bits;
+	static LocalVector<DataBindPropertyInfo> properties;
+	static HashMap<StringName, uint32_t> property_ids; // Metadata key to index in properties
+	static Callable texture_resolver;
+	static HashMap<Variant, Ref<Texture2D>, VariantHasher, VariantComparator> textures; // Resolved texture of every key, shared by all DataBinds
 
-	static Ref<Expression> get_expression(const String &expression_string);
+	static uint32_t add_property(const StringName &meta, const StringName &property, const StringName &setter, Variant::Type type, const StringName &class_name = StringName());
+	static void register_builtin_properties();
+	static int get_property_id(const StringName &meta);
+	static DataBindSetter get_setter(uint32_t property_id, const StringName &class_name);
+	static void call_setter(Control *node, MethodBind *setter, const Variant &value);
+	void resize_groups();
+	void bind_property(Control *node, uint32_t property_id, uint64_t tags);
+
+	Ref<DataBindExpression> get_expression(const String &expression_string);
+	static uint64_t get_tag_mask(const String &p_tags);
+	static bool is_property_dirty(bool &r_dirty, uint64_t p_tags, uint64_t p_invalidated_tags, bool p_tagged_only);
+	DataBindGetter get_getter(const String &p_method);
+	bool get_value(const DataBindGetter &p_getter, Variant &r_value) const;
+	static String get_getter_error(const DataBindGetter &p_getter);
 	void setup_pressed(Control *node);
+	void _on_pressed_refresh(const Callable &p_callable, uint64_t p_tags);
 	void setup_datamodel(Control *node);
+	void setup_text_format(Control *node, uint64_t tags);
+	const DataBindGetter *update_text_format(DataBindTextFormat &text_format);
+	void setup_tr_text(Control *node, const StringName &meta, DataBindProperty property, uint64_t tags);
+	const DataBindGetter *update_tr_text(DataBindTrText &tr_text);
+	void setup_items(Control *node, uint64_t tags);
+	const DataBindGetter *update_items(DataBindItems &items);
+	void setup_progress(Control *node, uint64_t tags);
+	const DataBindGetter *update_progress(DataBindProgress &progress);
+	void interpolate_progress(double p_delta);
+	void apply_items(DataBindItems &items, const Array &descriptors);
+	void setup_two_way(Control *node, uint64_t tags);
+	DataBindTwoWay *get_two_way(Control *node);
+	void _on_two_way_changed(const Variant &p_value, Control *p_node);
+	void _on_two_way_editing(bool p_editing, Control *p_node);
+	void write_two_ways();
+	const DataBindGetter *update_two_way(DataBindTwoWay &two_way);
+	void disconnect_two_way(const DataBindTwoWay &two_way);
+	template <typename T> static void apply_items(T *node, LocalVector<DataBindItem> &items, const Array &descriptors);
+	void setup_texture_key(Control *node, const StringName &meta, DataBindProperty property, uint64_t tags);
+	const DataBindGetter *update_texture_key(DataBindTextureKey &texture_key);
+	static Ref<Texture2D> resolve_texture(const Variant &key);
+	void setup_datamodel_batch(Control *node, uint64_t tags);
+	const DataBindGetter *update_datamodel_batch(DataBindBatch &batch);
+	void resolve_batch_targets(DataBindBatch &batch);
+	bool apply_batch(DataBindBatch &batch, const Variant &values);
+	template <typename T> void apply_batch_values(DataBindBatch &batch, const T &values);
+	void _on_datamodel_children_changed(Control *p_node);
+
+	// Execute callable_or_expr and check that the result can be passed into setter.
+	template <typename T> DataBindFailure execute(const T &callable_or_expr, const DataBindSetter &setter, Variant &result);
+	template <typename T> static String get_failure_message(DataBindFailure failure, const T &callable_or_expr, Control *node, uint32_t property_id, const DataBindSetter &setter, const Variant &result);
+	template <typename F> void binding_failed(DataBindStatus &status, Control *node, const StringName &property, const F &get_message);
+	void binding_recovered(DataBindStatus &status);
+	_FORCE_INLINE_ bool is_quarantined(const DataBindStatus &status) const { return status.retry_frame > frame; }
+	uint32_t get_binding_id(uint16_t table, uint32_t index) const;
+	template <typename T>
+	void update_rows(ArenaVector<T> &rows, const StringName &property, const DataBindGetter *(DataBind::*update_row)(T &), uint64_t p_invalidated_tags, bool p_tagged_only);
+	void queue_set(Control *node, MethodBind *setter, const Variant &value);
+	void apply_pending_sets();
+	void _on_sort_children();
+	template <typename T> void apply_group_value(uint32_t property_id, DataBindGroup<T> &group, uint32_t index, const Variant &value);
+	template <typename T> void update_group(uint32_t property_id, DataBindGroup<T> &group, uint64_t p_invalidated_tags, bool p_tagged_only);
 
-	template <typename T> void execute(const T &callable_or_expr, Control *node, const StringName &method, Variant::Type expected_type, const StringName &expected_class = "");
-	template <typename T> void update_properties(Control *node, const T &property);
+	_FORCE_INLINE_ void trace_apply(const Variant &value) {
+		if (unlikely(trace.is_valid())) {
+			trace_value = value;
+			trace_applied = true;
+		}
+	}
+	void check_reference();
+	template <typename T> void check_reference_group(uint32_t property_id, DataBindGroup<T> &group);
+	void check_reference_text_format(DataBindTextFormat &text_format);
+	void check_reference_tr_text(DataBindTrText &tr_text);
+	void check_reference_items(DataBindItems &items);
+	void check_reference_texture_key(DataBindTextureKey &texture_key);
+	void check_reference_batch(DataBindBatch &batch);
+	void report_divergence(uint32_t id, Control *node, const String &property, const Variant &actual, const Variant &expected, bool tagged);
+	void trace_binding(uint32_t id, const Variant &value, uint64_t usec, bool applied);
+	void replay_binding(const DataBindRef &ref, const Variant &value);
 
-	// Fill node_expressions with all nodes that are Controls, have ceratin metadata properties, and are owned by this->parent.
+	// Register all Controls in the subtree of node_to_check, nested DataBinds register their own subtree.
 	void _find_metadata_properties(Node *node_to_check);
 	void init_databind();
 
+	// Controls that enter the subtree after init_databind are registered when they enter, Controls that exit are removed on the next update
+	// if they were freed or moved out of this DataBind. Both only touch the Controls that actually entered or exited.
+	void register_node(Control *node);
+	void unregister_node(Control *node, bool p_alive);
+	void remove_binding(const DataBindRef &ref);
+	void release_property(Control *node, uint32_t property_id);
+	void add_ref(Control *node, uint16_t table, uint32_t index);
+	uint32_t get_table_size(uint16_t table) const;
+	Control *remove_from_table(uint16_t table, uint32_t index);
+	void remove_exited_nodes();
+	void _on_child_entered_tree(Node *p_node);
+	void _on_child_exiting_tree(Node *p_node);
+
 	// Execute all DataBind metadata properties and then update the UI with the result of each one.
-	void update();
+	// If p_tagged_only is true only dirty tagged properties are executed.
+	void update(bool p_tagged_only = false);
 
 protected:
 	static void _bind_methods();
 	void _notification(int p_what);
 	void set_base_instance(Object *p_object);
 
+	// Pin p_source at the start of every update so getters can read game state published by another thread, see DataBindSnapshot.
+	void set_snapshot_source(DataBindSnapshotSource *p_source);
+
 public:
 	// Call to init DataBind scene.
 	// Loads scene file from disk and then fills all DataBind metadata properties.
 	static DataBind *init(const String &p_path);
+
+	DataBind();
+
+	// Number of bindings and the estimated size in bytes of all binding tables of this DataBind.
+	Dictionary get_memory_footprint() const;
+
+	// Allocation statistics of the arena that owns the binding tables and Expressions of this DataBind.
+	Dictionary get_arena_stats() const;
+
+	// Binding counts by kind, Callables vs Expressions, memory, datamodel children, and the cost of the last update of this DataBind.
+	Dictionary get_report() const;
+
+	// get_report of every live DataBind.
+	static TypedArray<Dictionary> get_reports();
+
+	// Write get_reports to p_path as JSON, for capacity planning from headless runs.
+	static Error dump_reports(const String &p_path);
+
+	// Number of times Containers in this DataBind sorted their children during the last physics frame.
+	uint32_t get_layout_passes() const;
+
+	// Bindings that are currently skipped because they kept failing, with the error of their first failure.
+	TypedArray<Dictionary> get_quarantined_bindings() const;
+
+	// Debug mode that runs the original unoptimised update every p_frames physics frames after the normal update and reports every
+	// property where the two disagree, 0 disables it.
+	void set_reference_check_interval(uint32_t p_frames);
+	uint32_t get_reference_check_interval() const;
+
+	// Divergences found by the last reference check, each one has the path, property, actual and expected value, and if it is tagged.
+	TypedArray<Dictionary> get_reference_divergences() const;
+
+	// Stream every binding this DataBind executes to a trace file until stop_trace is called.
+	Error start_trace(const String &p_path);
+	void stop_trace();
+
+	// Instantiate the scene of a trace without its game data and apply the recorded results update by update.
+	// Returns how long the setters and the layout passes they caused took, which doesn't depend on the game.
+	static Dictionary replay_trace(const String &p_path);
+
+	// Execute p_expression p_iterations times on p_base with both DataBindExpression and Expression and return how long each one took.
+	static Dictionary benchmark_expression(const String &p_expression, Object *p_base, uint32_t p_iterations);
+
+	// Make p_meta metadata bindable to p_property of any Control class that has it, like the built in properties.
+	// Metadata named bind_<property> (bind_modulate, bind_max_value...) is bindable without registering it.
+	static void register_property(const StringName &p_meta, const StringName &p_property);
+
+	// Callable that takes a texture_key / icon_key and returns its Texture2D, keys are loaded as resource paths if there is no resolver.
+	// Every key is only resolved once, changing the resolver clears the texture cache.
+	static void set_texture_resolver(const Callable &p_resolver);
+	static void clear_texture_cache();
+
+	// Mark all bindings with p_tag in their "tags" metadata as dirty so they are executed on the next update.
+	// Must be called from the main thread.
+	static void invalidate(const StringName &p_tag);
 };
 
 } // namespace CG
@@ -0,0 +1,100 @@
+#include "DataBindArena.hpp"
+
+using namespace CG;
+
+uint32_t DataBindArena::get_size_class(uint64_t p_size) {
+	uint32_t size_class = 0;
+	while ((uint64_t(1) << (size_class + MIN_BLOCK_SHIFT)) < p_size)
+		size_class++;
+
+	return size_class;
+}
+
+uint8_t *DataBindArena::alloc_chunk(uint64_t p_size) {
+	uint8_t *chunk = static_cast<uint8_t *>(Memory::alloc_static(p_size));
+	chunks.push_back(chunk);
+	reserved_bytes += p_size;
+	return chunk;
+}
+
+void *DataBindArena::alloc(uint64_t p_size) {
+	const uint32_t size_class = get_size_class(p_size);
+	ERR_FAIL_COND_V(size_class >= SIZE_CLASSES, nullptr);
+	const uint64_t block_size = uint64_t(1) << (size_class + MIN_BLOCK_SHIFT);
+
+	allocations++;
+	used_bytes += block_size;
+
+	FreeBlock *block = free_blocks[size_class];
+	if (block != nullptr) {
+		free_blocks[size_class] = block->next;
+		recycled_bytes -= block_size;
+		return block;
+	}
+
+	// Blocks bigger than a quarter chunk get their own chunk so big tables don't waste the rest of the current chunk.
+	if (block_size > CHUNK_SIZE / 4)
+		return alloc_chunk(block_size);
+
+	if (position == nullptr or uint64_t(end - position) < block_size) {
+		position = alloc_chunk(CHUNK_SIZE);
+		end = position + CHUNK_SIZE;
+	}
+
+	void *result = position;
+	position += block_size;
+	return result;
+}
+
+void DataBindArena::free(void *p_block, uint64_t p_size) {
+	const uint32_t size_class = get_size_class(p_size);
+	const uint64_t block_size = uint64_t(1) << (size_class + MIN_BLOCK_SHIFT);
+
+	FreeBlock *block = static_cast<FreeBlock *>(p_block);
+	block->next = free_blocks[size_class];
+	free_blocks[size_class] = block;
+	used_bytes -= block_size;
+	recycled_bytes += block_size;
+}
+
+void DataBindArena::destroy_object(const ArenaObject &p_object) {
+	RefCounted *object = p_object.object;
+	ERR_FAIL_COND_MSG(!object->unreference(), "DataBind arena object is still referenced when it is destroyed.");
+
+	// Same as memdelete without freeing the memory.
+	if (!predelete_handler(object))
+		return;
+	object->~RefCounted();
+	free(object, p_object.size);
+}
+
+void DataBindArena::collect() {
+	for (uint32_t i = 0; i < objects.size();) {
+		if (objects[i].object->get_reference_count() != 1) {
+			++i;
+			continue;
+		}
+
+		destroy_object(objects[i]);
+		objects.remove_at_unordered(i);
+	}
+}
+
+Dictionary DataBindArena::get_stats() const {
+	Dictionary stats;
+	stats["chunks"] = chunks.size();
+	stats["reserved_bytes"] = reserved_bytes;
+	stats["used_bytes"] = used_bytes;
+	stats["recycled_bytes"] = recycled_bytes;
+	stats["allocations"] = allocations;
+	stats["objects"] = objects.size();
+	return stats;
+}
+
+DataBindArena::~DataBindArena() {
+	for (const ArenaObject &object : objects)
+		destroy_object(object);
+
+	for (uint8_t *chunk : chunks)
+		Memory::free_static(chunk);
+}
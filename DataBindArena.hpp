@@ -0,0 +1,206 @@
+#pragma once
+
+#include "core/object/ref_counted.h"
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/dictionary.h"
+
+#include <type_traits>
+
+namespace CG {
+
+// Chunked bump allocator that owns all binding data of one DataBind.
+// Blocks are rounded up to a power of two and freed blocks are kept in a free list per size, so Controls that are registered and
+// unregistered over and over reuse the same blocks instead of fragmenting the heap. Chunks are only freed when the arena is destroyed.
+class DataBindArena {
+	static constexpr uint64_t CHUNK_SIZE = 16384;
+	static constexpr uint32_t MIN_BLOCK_SHIFT = 4; // 16 bytes so every block is aligned for anything stored in a binding table.
+	static constexpr uint32_t SIZE_CLASSES = 48;
+
+	struct FreeBlock {
+		FreeBlock *next{};
+	};
+
+	// RefCounted objects placed in the arena, the arena holds one reference so they are never memdelete'd.
+	struct ArenaObject {
+		RefCounted *object{};
+		uint32_t size{};
+	};
+
+	LocalVector<uint8_t *> chunks;
+	uint8_t *position{};
+	uint8_t *end{};
+	FreeBlock *free_blocks[SIZE_CLASSES]{};
+	LocalVector<ArenaObject> objects;
+
+	uint64_t reserved_bytes{};
+	uint64_t used_bytes{};
+	uint64_t recycled_bytes{};
+	uint64_t allocations{};
+
+	static uint32_t get_size_class(uint64_t p_size);
+	uint8_t *alloc_chunk(uint64_t p_size);
+	void destroy_object(const ArenaObject &p_object);
+
+public:
+	void *alloc(uint64_t p_size);
+	void free(void *p_block, uint64_t p_size);
+
+	template <typename T> Ref<T> make_ref() {
+		T *object = memnew_placement(alloc(sizeof(T)), T);
+		Ref<T> ref(object);
+		object->reference();
+
+		ArenaObject arena_object;
+		arena_object.object = object;
+		arena_object.size = sizeof(T);
+		objects.push_back(arena_object);
+		return ref;
+	}
+
+	// Destroy objects that are only referenced by the arena anymore.
+	void collect();
+
+	Dictionary get_stats() const;
+
+	DataBindArena() = default;
+	DataBindArena(const DataBindArena &) = delete;
+	DataBindArena &operator=(const DataBindArena &) = delete;
+	~DataBindArena();
+};
+
+// Vector that allocates from a DataBindArena. set_arena has to be called before the first push_back.
+template <typename T> class ArenaVector {
+	DataBindArena *arena{};
+	T *data{};
+	uint32_t count{};
+	uint32_t capacity{};
+
+	void reserve(uint32_t p_capacity) {
+		ERR_FAIL_NULL(arena);
+		T *new_data = static_cast<T *>(arena->alloc(uint64_t(p_capacity) * sizeof(T)));
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (count > 0)
+				memcpy(new_data, data, count * sizeof(T));
+		} else {
+			for (uint32_t i = 0; i < count; ++i) {
+				memnew_placement(&new_data[i], T(std::move(data[i])));
+				data[i].~T();
+			}
+		}
+
+		if (data != nullptr)
+			arena->free(data, uint64_t(capacity) * sizeof(T));
+		data = new_data;
+		capacity = p_capacity;
+	}
+
+	void release() {
+		clear();
+		if (data != nullptr)
+			arena->free(data, uint64_t(capacity) * sizeof(T));
+		data = nullptr;
+		capacity = 0;
+	}
+
+public:
+	_FORCE_INLINE_ void set_arena(DataBindArena *p_arena) { arena = p_arena; }
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ T *ptr() { return data; }
+	_FORCE_INLINE_ const T *ptr() const { return data; }
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	_FORCE_INLINE_ T &operator[](uint32_t p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ const T &operator[](uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	void push_back(const T &p_value) {
+		if (count == capacity)
+			reserve(capacity == 0 ? 4 : capacity * 2);
+		memnew_placement(&data[count++], T(p_value));
+	}
+
+	void push_back(T &&p_value) {
+		if (count == capacity)
+			reserve(capacity == 0 ? 4 : capacity * 2);
+		memnew_placement(&data[count++], T(std::move(p_value)));
+	}
+
+	void remove_at_unordered(uint32_t p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		if (p_index < count)
+			data[p_index] = std::move(data[count]);
+		data[count].~T();
+	}
+
+	void clear() {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (uint32_t i = 0; i < count; ++i)
+				data[i].~T();
+		}
+		count = 0;
+	}
+
+	ArenaVector() = default;
+
+	ArenaVector(const ArenaVector &p_from) :
+			arena(p_from.arena) {
+		if (p_from.count == 0)
+			return;
+
+		reserve(p_from.count);
+		for (const T &value : p_from)
+			memnew_placement(&data[count++], T(value));
+	}
+
+	ArenaVector(ArenaVector &&p_from) :
+			arena(p_from.arena), data(p_from.data), count(p_from.count), capacity(p_from.capacity) {
+		p_from.data = nullptr;
+		p_from.count = 0;
+		p_from.capacity = 0;
+	}
+
+	ArenaVector &operator=(const ArenaVector &p_from) {
+		if (this == &p_from)
+			return *this;
+
+		release();
+		arena = p_from.arena;
+		if (p_from.count > 0) {
+			reserve(p_from.count);
+			for (const T &value : p_from)
+				memnew_placement(&data[count++], T(value));
+		}
+		return *this;
+	}
+
+	ArenaVector &operator=(ArenaVector &&p_from) {
+		if (this == &p_from)
+			return *this;
+
+		release();
+		arena = p_from.arena;
+		data = p_from.data;
+		count = p_from.count;
+		capacity = p_from.capacity;
+		p_from.data = nullptr;
+		p_from.count = 0;
+		p_from.capacity = 0;
+		return *this;
+	}
+
+	~ArenaVector() { release(); }
+};
+
+} // namespace CG
@@ -0,0 +1,603 @@
+#include "DataBindExpression.hpp"
+
+#include "core/object/class_db.h"
+#include "core/variant/variant_internal.h"
+
+using namespace CG;
+
+namespace CG {
+
+// Recursive descent compiler, every compile function writes the result of its subexpression into dst and only uses registers above dst
+// as temporaries. Returns false for anything it doesn't handle so the expression falls back to Expression.
+class DataBindExpressionCompiler {
+	enum TokenType : uint8_t {
+		TK_CONSTANT,
+		TK_IDENTIFIER,
+		TK_OPERATOR,
+		TK_AND,
+		TK_OR,
+		TK_NOT,
+		TK_PARENTHESIS_OPEN,
+		TK_PARENTHESIS_CLOSE,
+		TK_COMMA,
+		TK_EOF,
+	};
+
+	struct Token {
+		TokenType type = TK_EOF;
+		Variant value; // Constant or identifier
+		Variant::Operator op = Variant::OP_MAX;
+	};
+
+	DataBindExpression &expression;
+	StringName base_class;
+	LocalVector<Token> tokens;
+	uint32_t position{};
+	int max_register{};
+
+	bool tokenize(const String &p_expression);
+	const Token &peek() const { return tokens[position]; }
+	bool is_operator(Variant::Operator p_op) const { return peek().type == TK_OPERATOR and peek().op == p_op; }
+
+	uint32_t emit(DataBindExpression::Opcode p_opcode, int p_dst, int p_a = 0, int p_b = 0, int p_c = 0) {
+		DataBindExpression::Instruction instruction;
+		instruction.opcode = p_opcode;
+		instruction.dst = p_dst;
+		instruction.a = p_a;
+		instruction.b = p_b;
+		instruction.c = p_c;
+		expression.instructions.push_back(instruction);
+		return expression.instructions.size() - 1;
+	}
+
+	bool use_register(int p_register) {
+		if (p_register >= DataBindExpression::MAX_REGISTERS)
+			return false;
+
+		max_register = MAX(max_register, p_register);
+		return true;
+	}
+
+	bool compile_or(int dst);
+	bool compile_and(int dst);
+	bool compile_not(int dst);
+	bool compile_equality(int dst);
+	bool compile_relational(int dst);
+	bool compile_additive(int dst);
+	bool compile_multiplicative(int dst);
+	bool compile_unary(int dst);
+	bool compile_primary(int dst);
+
+public:
+	bool compile(const String &p_expression);
+
+	DataBindExpressionCompiler(DataBindExpression &p_expression, const StringName &p_base_class) :
+			expression(p_expression), base_class(p_base_class) {}
+};
+
+} // namespace CG
+
+bool DataBindExpressionCompiler::tokenize(const String &p_expression) {
+	const char32_t *text = p_expression.ptr();
+	const int length = p_expression.length();
+	int i = 0;
+	while (i < length) {
+		const char32_t c = text[i];
+		if (is_whitespace(c)) {
+			i++;
+			continue;
+		}
+
+		Token token;
+		if (is_digit(c) or (c == '.' and i + 1 < length and is_digit(text[i + 1]))) {
+			int end = i;
+			bool is_float = false;
+			while (end < length and (is_digit(text[end]) or text[end] == '.' or text[end] == 'e' or text[end] == 'E' or text[end] == '_' or
+											((text[end] == '-' or text[end] == '+') and (text[end - 1] == 'e' or text[end - 1] == 'E')))) {
+				is_float = is_float or text[end] == '.' or text[end] == 'e' or text[end] == 'E';
+				end++;
+			}
+
+			const String number = p_expression.substr(i, end - i).remove_char('_');
+			token.type = TK_CONSTANT;
+			token.value = is_float ? Variant(number.to_float()) : Variant(number.to_int());
+			i = end;
+		} else if (c == '"' or c == '\'') {
+			String string;
+			int end = i + 1;
+			while (end < length and text[end] != c) {
+				if (text[end] == '\\') {
+					if (++end >= length)
+						return false;
+
+					switch (text[end]) {
+						case 'n':
+							string += '\n';
+							break;
+						case 't':
+							string += '\t';
+							break;
+						case '\\':
+						case '"':
+						case '\'':
+							string += text[end];
+							break;
+						default:
+							return false; // Let Expression handle the other escapes
+					}
+				} else {
+					string += text[end];
+				}
+				end++;
+			}
+
+			if (end >= length)
+				return false;
+
+			token.type = TK_CONSTANT;
+			token.value = string;
+			i = end + 1;
+		} else if (is_unicode_identifier_start(c)) {
+			int end = i;
+			while (end < length and is_unicode_identifier_continue(text[end]))
+				end++;
+
+			const String identifier = p_expression.substr(i, end - i);
+			if (identifier == "true" or identifier == "false") {
+				token.type = TK_CONSTANT;
+				token.value = identifier == "true";
+			} else if (identifier == "null") {
+				token.type = TK_CONSTANT;
+			} else if (identifier == "and") {
+				token.type = TK_AND;
+			} else if (identifier == "or") {
+				token.type = TK_OR;
+			} else if (identifier == "not") {
+				token.type = TK_NOT;
+			} else {
+				token.type = TK_IDENTIFIER;
+				token.value = StringName(identifier);
+			}
+			i = end;
+		} else {
+			const char32_t next = i + 1 < length ? text[i + 1] : 0;
+			int size = 1;
+			token.type = TK_OPERATOR;
+			switch (c) {
+				case '(':
+					token.type = TK_PARENTHESIS_OPEN;
+					break;
+				case ')':
+					token.type = TK_PARENTHESIS_CLOSE;
+					break;
+				case ',':
+					token.type = TK_COMMA;
+					break;
+				case '+':
+					token.op = Variant::OP_ADD;
+					break;
+				case '-':
+					token.op = Variant::OP_SUBTRACT;
+					break;
+				case '*':
+					token.op = Variant::OP_MULTIPLY;
+					break;
+				case '/':
+					token.op = Variant::OP_DIVIDE;
+					break;
+				case '%':
+					token.op = Variant::OP_MODULE;
+					break;
+				case '<':
+					token.op = next == '=' ? Variant::OP_LESS_EQUAL : Variant::OP_LESS;
+					size = next == '=' ? 2 : 1;
+					break;
+				case '>':
+					token.op = next == '=' ? Variant::OP_GREATER_EQUAL : Variant::OP_GREATER;
+					size = next == '=' ? 2 : 1;
+					break;
+				case '=':
+					if (next != '=')
+						return false;
+					token.op = Variant::OP_EQUAL;
+					size = 2;
+					break;
+				case '!':
+					token.type = next == '=' ? TK_OPERATOR : TK_NOT;
+					token.op = Variant::OP_NOT_EQUAL;
+					size = next == '=' ? 2 : 1;
+					break;
+				case '&':
+					if (next != '&')
+						return false;
+					token.type = TK_AND;
+					size = 2;
+					break;
+				case '|':
+					if (next != '|')
+						return false;
+					token.type = TK_OR;
+					size = 2;
+					break;
+				default:
+					return false; // Indexing, member access, arrays, dictionaries, bitwise operators...
+			}
+			i += size;
+		}
+
+		tokens.push_back(token);
+	}
+
+	tokens.push_back(Token());
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile(const String &p_expression) {
+	if (!tokenize(p_expression) or !compile_or(0) or peek().type != TK_EOF)
+		return false;
+
+	emit(DataBindExpression::OP_RETURN, 0, 0);
+	expression.registers.resize(max_register + 1);
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_or(int dst) {
+	if (!compile_and(dst))
+		return false;
+
+	LocalVector<uint32_t> jumps;
+	while (peek().type == TK_OR) {
+		position++;
+		emit(DataBindExpression::OP_TO_BOOL, dst, dst);
+		jumps.push_back(emit(DataBindExpression::OP_JUMP_IF_TRUE, 0, dst));
+		if (!compile_and(dst))
+			return false;
+	}
+
+	if (jumps.is_empty())
+		return true;
+
+	emit(DataBindExpression::OP_TO_BOOL, dst, dst);
+	for (uint32_t jump : jumps)
+		expression.instructions[jump].b = expression.instructions.size();
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_and(int dst) {
+	if (!compile_not(dst))
+		return false;
+
+	LocalVector<uint32_t> jumps;
+	while (peek().type == TK_AND) {
+		position++;
+		emit(DataBindExpression::OP_TO_BOOL, dst, dst);
+		jumps.push_back(emit(DataBindExpression::OP_JUMP_IF_FALSE, 0, dst));
+		if (!compile_not(dst))
+			return false;
+	}
+
+	if (jumps.is_empty())
+		return true;
+
+	emit(DataBindExpression::OP_TO_BOOL, dst, dst);
+	for (uint32_t jump : jumps)
+		expression.instructions[jump].b = expression.instructions.size();
+	return true;
+}
+
+// Like Expression, not has a lower priority than comparisons.
+bool DataBindExpressionCompiler::compile_not(int dst) {
+	if (peek().type != TK_NOT)
+		return compile_equality(dst);
+
+	position++;
+	if (!compile_not(dst))
+		return false;
+
+	emit(DataBindExpression::OP_NOT, dst, dst);
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_equality(int dst) {
+	if (!compile_relational(dst))
+		return false;
+
+	while (is_operator(Variant::OP_EQUAL) or is_operator(Variant::OP_NOT_EQUAL)) {
+		const Variant::Operator op = tokens[position++].op;
+		if (!use_register(dst + 1) or !compile_relational(dst + 1))
+			return false;
+		emit(DataBindExpression::OP_BINARY, dst, dst, dst + 1, op);
+	}
+
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_relational(int dst) {
+	if (!compile_additive(dst))
+		return false;
+
+	while (is_operator(Variant::OP_LESS) or is_operator(Variant::OP_LESS_EQUAL) or is_operator(Variant::OP_GREATER) or is_operator(Variant::OP_GREATER_EQUAL)) {
+		const Variant::Operator op = tokens[position++].op;
+		if (!use_register(dst + 1) or !compile_additive(dst + 1))
+			return false;
+		emit(DataBindExpression::OP_BINARY, dst, dst, dst + 1, op);
+	}
+
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_additive(int dst) {
+	if (!compile_multiplicative(dst))
+		return false;
+
+	while (is_operator(Variant::OP_ADD) or is_operator(Variant::OP_SUBTRACT)) {
+		const Variant::Operator op = tokens[position++].op;
+		if (!use_register(dst + 1) or !compile_multiplicative(dst + 1))
+			return false;
+		emit(DataBindExpression::OP_BINARY, dst, dst, dst + 1, op);
+	}
+
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_multiplicative(int dst) {
+	if (!compile_unary(dst))
+		return false;
+
+	while (is_operator(Variant::OP_MULTIPLY) or is_operator(Variant::OP_DIVIDE) or is_operator(Variant::OP_MODULE)) {
+		const Variant::Operator op = tokens[position++].op;
+		if (!use_register(dst + 1) or !compile_unary(dst + 1))
+			return false;
+		emit(DataBindExpression::OP_BINARY, dst, dst, dst + 1, op);
+	}
+
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_unary(int dst) {
+	if (!is_operator(Variant::OP_SUBTRACT))
+		return compile_primary(dst);
+
+	position++;
+	if (!compile_unary(dst))
+		return false;
+
+	emit(DataBindExpression::OP_NEGATE, dst, dst);
+	return true;
+}
+
+bool DataBindExpressionCompiler::compile_primary(int dst) {
+	const Token &token = tokens[position++];
+	switch (token.type) {
+		case TK_CONSTANT: {
+			expression.constants.push_back(token.value);
+			emit(DataBindExpression::OP_CONSTANT, dst, expression.constants.size() - 1);
+			return true;
+		}
+		case TK_PARENTHESIS_OPEN: {
+			if (!compile_or(dst) or peek().type != TK_PARENTHESIS_CLOSE)
+				return false;
+			position++;
+			return true;
+		}
+		case TK_IDENTIFIER: {
+			// Bare identifiers are properties and utility functions like str() have priority over methods in Expression, leave both to it.
+			const StringName name = token.value;
+			if (peek().type != TK_PARENTHESIS_OPEN or Variant::has_utility_function(name))
+				return false;
+
+			MethodBind *method = ClassDB::get_method(base_class, name);
+			if (method == nullptr)
+				return false; // Script methods
+
+			position++;
+			int count = 0;
+			while (peek().type != TK_PARENTHESIS_CLOSE) {
+				if (count > 0) {
+					if (peek().type != TK_COMMA)
+						return false;
+					position++;
+				}
+
+				const int arg = dst + 1 + count;
+				if (count == DataBindExpression::MAX_ARGUMENTS or !use_register(arg) or !compile_or(arg))
+					return false;
+				count++;
+			}
+			position++;
+
+			expression.methods.push_back(method);
+			emit(DataBindExpression::OP_CALL, dst, expression.methods.size() - 1, dst + 1, count);
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+
+Error DataBindExpression::parse(const String &p_expression, const Object *p_base) {
+	instructions.clear();
+	constants.clear();
+	methods.clear();
+	registers.clear();
+	fallback.unref();
+	parse_failed = false;
+	error_text = String();
+
+	if (p_base != nullptr) {
+		DataBindExpressionCompiler compiler(*this, p_base->get_class_name());
+		if (compiler.compile(p_expression))
+			return OK;
+	}
+
+	instructions.clear();
+	constants.clear();
+	methods.clear();
+	registers.clear();
+	fallback.instantiate();
+	const Error err = fallback->parse(p_expression);
+	parse_failed = err != OK;
+	return err;
+}
+
+// Ints and floats are handled without going through Variant::evaluate, everything else behaves exactly like Expression.
+_FORCE_INLINE_ bool DataBindExpression::evaluate(Variant::Operator p_operator, const Variant &p_a, const Variant &p_b, Variant &r_result) {
+	const Variant::Type a_type = p_a.get_type();
+	const Variant::Type b_type = p_b.get_type();
+	if (a_type == Variant::INT and b_type == Variant::INT) {
+		const int64_t a = *VariantInternal::get_int(&p_a);
+		const int64_t b = *VariantInternal::get_int(&p_b);
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				r_result = a + b;
+				return true;
+			case Variant::OP_SUBTRACT:
+				r_result = a - b;
+				return true;
+			case Variant::OP_MULTIPLY:
+				r_result = a * b;
+				return true;
+			case Variant::OP_EQUAL:
+				r_result = a == b;
+				return true;
+			case Variant::OP_NOT_EQUAL:
+				r_result = a != b;
+				return true;
+			case Variant::OP_LESS:
+				r_result = a < b;
+				return true;
+			case Variant::OP_LESS_EQUAL:
+				r_result = a <= b;
+				return true;
+			case Variant::OP_GREATER:
+				r_result = a > b;
+				return true;
+			case Variant::OP_GREATER_EQUAL:
+				r_result = a >= b;
+				return true;
+			default:
+				break; // Division and modulo have to check for 0
+		}
+	} else if ((a_type == Variant::FLOAT or a_type == Variant::INT) and (b_type == Variant::FLOAT or b_type == Variant::INT)) {
+		const double a = a_type == Variant::FLOAT ? *VariantInternal::get_float(&p_a) : double(*VariantInternal::get_int(&p_a));
+		const double b = b_type == Variant::FLOAT ? *VariantInternal::get_float(&p_b) : double(*VariantInternal::get_int(&p_b));
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				r_result = a + b;
+				return true;
+			case Variant::OP_SUBTRACT:
+				r_result = a - b;
+				return true;
+			case Variant::OP_MULTIPLY:
+				r_result = a * b;
+				return true;
+			case Variant::OP_DIVIDE:
+				r_result = a / b;
+				return true;
+			case Variant::OP_EQUAL:
+				r_result = a == b;
+				return true;
+			case Variant::OP_NOT_EQUAL:
+				r_result = a != b;
+				return true;
+			case Variant::OP_LESS:
+				r_result = a < b;
+				return true;
+			case Variant::OP_LESS_EQUAL:
+				r_result = a <= b;
+				return true;
+			case Variant::OP_GREATER:
+				r_result = a > b;
+				return true;
+			case Variant::OP_GREATER_EQUAL:
+				r_result = a >= b;
+				return true;
+			default:
+				break;
+		}
+	}
+
+	bool valid = false;
+	Variant::evaluate(p_operator, p_a, p_b, r_result, valid);
+	return valid;
+}
+
+bool DataBindExpression::execute(Object *p_base, Variant &r_result) {
+	if (fallback.is_valid()) {
+		// Expression prints every failure unless show_error is false and prints on every execute after a parse error, bindings only log
+		// their first failure.
+		if (unlikely(parse_failed))
+			return false;
+
+		static const Array inputs;
+		r_result = fallback->execute(inputs, p_base, false);
+		return !fallback->has_execute_failed();
+	}
+
+	Variant *r = registers.ptr();
+	for (uint32_t pc = 0; pc < instructions.size(); ++pc) {
+		const Instruction &instruction = instructions[pc];
+		switch (instruction.opcode) {
+			case OP_CONSTANT: {
+				r[instruction.dst] = constants[instruction.a];
+			} break;
+			case OP_CALL: {
+				const Variant *args[MAX_ARGUMENTS];
+				for (int i = 0; i < instruction.c; ++i)
+					args[i] = &r[instruction.b + i];
+
+				Callable::CallError call_error;
+				r[instruction.dst] = methods[instruction.a]->call(p_base, args, instruction.c, call_error);
+				if (unlikely(call_error.error != Callable::CallError::CALL_OK)) {
+					error_text = "Calling " + String(methods[instruction.a]->get_name()) + " failed.";
+					return false;
+				}
+			} break;
+			case OP_NOT: {
+				r[instruction.dst] = !r[instruction.a].booleanize();
+			} break;
+			case OP_NEGATE: {
+				if (unlikely(!evaluate(Variant::OP_NEGATE, r[instruction.a], Variant(), r[instruction.dst]))) {
+					error_text = "Invalid operand to unary -: " + Variant::get_type_name(r[instruction.a].get_type()) + ".";
+					return false;
+				}
+			} break;
+			case OP_TO_BOOL: {
+				r[instruction.dst] = r[instruction.a].booleanize();
+			} break;
+			case OP_BINARY: {
+				const Variant::Operator op = Variant::Operator(instruction.c);
+				if (unlikely(!evaluate(op, r[instruction.a], r[instruction.b], r[instruction.dst]))) {
+					error_text = "Invalid operands to operator " + Variant::get_operator_name(op) + ", " + Variant::get_type_name(r[instruction.a].get_type()) + " and " + Variant::get_type_name(r[instruction.b].get_type()) + ".";
+					return false;
+				}
+			} break;
+			case OP_JUMP_IF_FALSE: {
+				if (!r[instruction.a].booleanize())
+					pc = instruction.b - 1;
+			} break;
+			case OP_JUMP_IF_TRUE: {
+				if (r[instruction.a].booleanize())
+					pc = instruction.b - 1;
+			} break;
+			case OP_RETURN: {
+				r_result = r[instruction.a];
+				return true;
+			} break;
+		}
+	}
+
+	return false;
+}
+
+Variant DataBindExpression::call(Object *p_base) {
+	Variant result;
+	if (unlikely(!execute(p_base, result))) {
+		const String error = get_error_text();
+		if (error != logged_call_error) {
+			logged_call_error = error;
+			print_error(error.is_empty() ? String("Pressed expression failed.") : error);
+		}
+	}
+	return result;
+}
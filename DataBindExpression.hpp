@@ -0,0 +1,65 @@
+#pragma once
+
+#include "core/math/expression.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+
+namespace CG {
+
+// Replacement for Expression that handles the part of the Expression grammar bindings use: literals, method calls on the base instance,
+// !/not, &&/and, ||/or, comparisons, and arithmetic. It is compiled once into a flat instruction array that works on a small register
+// file, methods are resolved to MethodBinds at compile time and && and || short circuit. Anything else is executed by an Expression.
+class DataBindExpression : public RefCounted {
+	GDCLASS(DataBindExpression, RefCounted)
+
+	friend class DataBindExpressionCompiler;
+
+	enum Opcode : uint8_t {
+		OP_CONSTANT, // dst = constants[a]
+		OP_CALL, // dst = methods[a](registers[b], ..., registers[b + c - 1])
+		OP_NOT, // dst = !registers[a]
+		OP_NEGATE, // dst = -registers[a]
+		OP_TO_BOOL, // dst = bool(registers[a])
+		OP_BINARY, // dst = registers[a] <Variant::Operator c> registers[b]
+		OP_JUMP_IF_FALSE, // if !registers[a] jump to b
+		OP_JUMP_IF_TRUE, // if registers[a] jump to b
+		OP_RETURN, // return registers[a]
+	};
+
+	struct Instruction {
+		Opcode opcode = OP_RETURN;
+		uint8_t dst{};
+		uint16_t a{};
+		uint16_t b{};
+		uint16_t c{};
+	};
+
+	static constexpr int MAX_REGISTERS = 256;
+	static constexpr int MAX_ARGUMENTS = 8;
+
+	LocalVector<Instruction> instructions;
+	LocalVector<Variant> constants;
+	LocalVector<MethodBind *> methods;
+	LocalVector<Variant> registers;
+	Ref<Expression> fallback; // Only valid if the expression couldn't be compiled
+	bool parse_failed = false; // The fallback couldn't be parsed either
+	String error_text;
+	String logged_call_error; // Last error logged by call, a handler that keeps failing the same way is only logged once
+
+	static bool evaluate(Variant::Operator p_operator, const Variant &p_a, const Variant &p_b, Variant &r_result);
+
+public:
+	// Compile p_expression for objects of p_base's class, falls back to Expression if it uses anything the compiler doesn't handle.
+	Error parse(const String &p_expression, const Object *p_base);
+
+	// Returns false and sets the error text if the execution failed.
+	bool execute(Object *p_base, Variant &r_result);
+
+	// Execute and log the error if it failed, used for pressed Callables which have no caller to report to.
+	Variant call(Object *p_base);
+
+	bool is_compiled() const { return fallback.is_null(); }
+	String get_error_text() const { return fallback.is_valid() ? fallback->get_error_text() : error_text; }
+};
+
+} // namespace CG
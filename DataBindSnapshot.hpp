@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/config/engine.h"
+
+#include <atomic>
+
+namespace CG {
+
+// Game state that a DataBind pins before every update so its getters read one consistent state while the simulation keeps running
+// on another thread. See DataBindSnapshot.
+class DataBindSnapshotSource {
+	uint64_t pinned_frame = UINT64_MAX;
+
+protected:
+	virtual void acquire() = 0;
+
+public:
+	// Called by DataBind::update on the main thread, the latest published snapshot is pinned once per physics frame so every DataBind
+	// that shares the source reads the same snapshot for the whole frame.
+	void pin() {
+		const uint64_t physics_frame = Engine::get_singleton()->get_physics_frames();
+		if (physics_frame == pinned_frame)
+			return;
+
+		pinned_frame = physics_frame;
+		acquire();
+	}
+
+	virtual ~DataBindSnapshotSource() = default;
+};
+
+// Lock free triple buffer of T. The simulation thread fills get_write() and calls publish() at the end of every tick, the main thread
+// reads get() which stays the same until the next pin. Neither thread ever waits for the other: the writer always has a slot of its own,
+// the reader keeps the slot it pinned, and the third slot holds the latest published snapshot until one of them swaps with it.
+// The write slot contains an old snapshot, the writer has to write the whole state every tick.
+template <typename T> class DataBindSnapshot : public DataBindSnapshotSource {
+	static constexpr uint8_t INDEX_MASK = 3;
+	static constexpr uint8_t PUBLISHED = 4; // Set if the shared slot has a snapshot the reader hasn't pinned yet
+
+	T slots[3];
+	uint8_t write_index = 0; // Only touched by the writer
+	uint8_t read_index = 1; // Only touched by the reader
+	std::atomic<uint8_t> shared{ 2 };
+
+protected:
+	void acquire() override {
+		if (shared.load(std::memory_order_relaxed) & PUBLISHED)
+			read_index = shared.exchange(read_index, std::memory_order_acq_rel) & INDEX_MASK; // Release so reads of the returned slot finish before the writer reuses it
+	}
+
+public:
+	// Simulation thread
+	T &get_write() { return slots[write_index]; }
+	void publish() { write_index = shared.exchange(write_index | PUBLISHED, std::memory_order_acq_rel) & INDEX_MASK; }
+
+	// Main thread, the snapshot pinned by the last update.
+	const T &get() const { return slots[read_index]; }
+};
+
+} // namespace CG
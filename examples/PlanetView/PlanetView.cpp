@@ -29,9 +29,11 @@ void PlanetView::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("GetStructures"), &PlanetView::GetStructures);
 	ClassDB::bind_method(D_METHOD("GetResourceStockpile"), &PlanetView::GetResourceStockpile);
+	ClassDB::bind_method(D_METHOD("GetResourceCounts"), &PlanetView::GetResourceCounts);
 
 	ClassDB::bind_method(D_METHOD("GetPlanetTexture"), &PlanetView::GetPlanetTexture);
 	ClassDB::bind_method(D_METHOD("HasBuildingQueue"), &PlanetView::HasBuildingQueue);
+	ClassDB::bind_method(D_METHOD("GetConstructionQueue"), &PlanetView::GetConstructionQueue);
 	ClassDB::bind_method(D_METHOD("ColonizeDisabled"), &PlanetView::ColonizeDisabled);
 	ClassDB::bind_method(D_METHOD("GetColonizeTooltip"), &PlanetView::GetColonizeTooltip);
 	ClassDB::bind_method(D_METHOD("GetColonizationProgress"), &PlanetView::GetColonizationProgress);
@@ -46,7 +48,6 @@ void PlanetView::_notification(int p_what) {
 			set_process(true);
 		} break;
 		case NOTIFICATION_PROCESS: {
-			update_building_queue();
 			update_player_position();
 		} break;
 	}
@@ -61,29 +62,8 @@ void PlanetView::update_player_position() {
 		distance_from_player = player->position.distance_to(data->position) * MATTER_TRANSFER_RANGE_MULTIPLIER;
 }
 
-void PlanetView::update_building_queue() {
-	if (!HasBuildingQueue())
-		return;
-
-	construction_queue->clear();
-	// Rebuild building queue items
-	const List<QueuedConstruction> &active_constructions = Construction::self->get_queued_construction(data->entity);
-	Array tt_array;
-	tt_array.resize(2);
-	for (int i = 0; i < active_constructions.size(); ++i) {
-		const QueuedConstruction &construction = active_constructions.get(i);
-		const StructureData &structure_data = StructureDB::self->get(construction.entity);
-		construction_queue->call_deferred("add_icon_item", Preloader::self->get_resource(structure_data.name));
-
-		tt_array[0] = tr(structure_data.name);
-		tt_array[1] = tr(itos(100 - Construction::self->get_progress(data->entity, i)));
-		construction_queue->call_deferred("set_item_tooltip", i, tr("CONSTRUCTION_QUEUE_TOOLTIP").format(tt_array));
-	}
-}
-
 void PlanetView::on_construction_queue_item_selected(int p_index) {
-	Construction::self->remove_from_queue(data->entity, p_index);
-	construction_queue->remove_item(p_index);
+	Construction::self->remove_from_queue(data->entity, p_index); // the items binding removes the item on the next update
 }
 
 float PlanetView::GetColonizationProgress() { return Colonization::self->get_progress(data->entity); }
@@ -181,8 +161,42 @@ Array PlanetView::GetResourceStockpile() {
 	return resource_nodes;
 }
 
+// Counts of every resource stockpile item, set on their labels by the datamodel_batch of the stockpile grid.
+PackedInt32Array PlanetView::GetResourceCounts() {
+	PackedInt32Array counts;
+	counts.resize(resource_stockpile_items.size());
+	for (int i = 0; i < resource_stockpile_items.size(); ++i)
+		counts.set(i, resource_stockpile_items[i]->GetResourceCount());
+
+	return counts;
+}
+
 bool PlanetView::HasBuildingQueue() { return Construction::self->planet_has_construction(data->entity); }
 
+Array PlanetView::GetConstructionQueue() {
+	Array items;
+	if (!HasBuildingQueue())
+		return items;
+
+	const List<QueuedConstruction> &active_constructions = Construction::self->get_queued_construction(data->entity);
+	Array tt_array;
+	tt_array.resize(2);
+	for (int i = 0; i < active_constructions.size(); ++i) {
+		const QueuedConstruction &construction = active_constructions.get(i);
+		const StructureData &structure_data = StructureDB::self->get(construction.entity);
+
+		tt_array[0] = tr(structure_data.name);
+		tt_array[1] = tr(itos(100 - Construction::self->get_progress(data->entity, i)));
+
+		Dictionary item;
+		item["icon"] = Preloader::self->get_resource(structure_data.name);
+		item["tooltip"] = tr("CONSTRUCTION_QUEUE_TOOLTIP").format(tt_array);
+		items.push_back(item);
+	}
+
+	return items;
+}
+
 Ref<ImageTexture> PlanetView::GetPlanetTexture() { return texture; }
 
 void PlanetView::OpenPlanetView(PlanetEntity p_entity) {
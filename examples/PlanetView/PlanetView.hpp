@@ -33,7 +33,6 @@ protected:
 public:
 	PlanetView();
 	void update_player_position();
-	void update_building_queue();
 	void on_construction_queue_item_selected(int p_index);
 	float GetColonizationProgress();
 	void OnColonizePressed();
@@ -46,7 +45,9 @@ public:
 	bool IsUncolonized();
 	Array GetStructures();
 	Array GetResourceStockpile();
+	PackedInt32Array GetResourceCounts();
 	bool HasBuildingQueue();
+	Array GetConstructionQueue();
 	Ref<ImageTexture> GetPlanetTexture();
 	void OpenPlanetView(PlanetEntity p_entity);
 };
@@ -0,0 +1,146 @@
+# Builds a DataBind scene with every binding kind, runs the reference check on every physics frame and exits with 1 if the optimised
+# update and the reference update disagreed or a binding failed.
+# godot --headless --script res://tools/reference_check.gd -- [frames]
+extends SceneTree
+
+const SCENE_PATH := "user://reference_check.tscn"
+
+# Values change at different rates so visibility, caching, tags and interpolation all get exercised.
+const BASE_SCRIPT := """
+extends DataBind
+
+var tick := 0
+
+
+func _physics_process(_delta: float) -> void:
+	tick += 1
+	if tick % 15 == 0:
+		DataBind.invalidate("reference_check")
+
+
+func GetText() -> String:
+	return str(tick)
+
+
+func GetTick() -> int:
+	return tick
+
+
+func GetRatio() -> float:
+	return tick / 7.0
+
+
+func IsVisible() -> bool:
+	return tick % 20 < 15
+
+
+func IsDisabled() -> bool:
+	return tick % 3 == 0
+
+
+func GetProgress() -> float:
+	return float(tick % 100)
+
+
+func GetTaggedText() -> String:
+	return str(tick / 15)
+
+
+func GetKey() -> String:
+	return "KEY_%d" % (tick / 10 % 3)
+
+
+func GetItems() -> Array:
+	var items := []
+	for i in tick / 10 % 5:
+		items.push_back({"text": "Item %d" % i, "disabled": (tick + i) % 4 == 0})
+	return items
+
+
+func OnPressed() -> void:
+	tick += 1
+"""
+
+var frames := 120
+var frame := 0
+var divergences := 0
+var databind: DataBind
+
+
+func _initialize() -> void:
+	var args := OS.get_cmdline_user_args()
+	if not args.is_empty():
+		frames = args[0].to_int()
+
+	if build_scene() != OK:
+		printerr("Can't build the reference check scene.")
+		quit(1)
+		return
+
+	databind = DataBind.init(SCENE_PATH)
+	if databind == null:
+		quit(1)
+		return
+
+	databind.set_reference_check_interval(1)
+	get_root().add_child(databind)
+
+
+func build_scene() -> Error:
+	var script := GDScript.new()
+	script.source_code = BASE_SCRIPT
+	var err := script.reload()
+	if err != OK:
+		return err
+
+	var root := DataBind.new()
+	root.name = "ReferenceCheck"
+	root.set_script(script)
+
+	var box := VBoxContainer.new()
+	add_control(root, root, box, {})
+	add_control(root, box, Label.new(), {"text": "GetText()", "visible": "IsVisible()"})
+	add_control(root, box, Label.new(), {"text_format": "{0} / {1:2}", "text_format_args": ["GetTick()", "GetRatio()"]})
+	add_control(root, box, Label.new(), {"tr_text": "GetKey()", "tr_text_args": ["GetTick()"]})
+	add_control(root, box, Label.new(), {"text": "GetTaggedText()", "tags": "reference_check"})
+	add_control(root, box, Button.new(), {"disabled": "IsDisabled()", "tooltip": "GetText()", "pressed": "OnPressed"})
+	add_control(root, box, ProgressBar.new(), {"progress": "GetProgress()"})
+	add_control(root, box, ProgressBar.new(), {"progress": "GetProgress()", "progress_rate": 0.25})
+	add_control(root, box, ItemList.new(), {"items": "GetItems()"})
+	add_control(root, box, OptionButton.new(), {"items": "GetItems()"})
+
+	var scene := PackedScene.new()
+	err = scene.pack(root)
+	root.free()
+	if err != OK:
+		return err
+	return ResourceSaver.save(scene, SCENE_PATH)
+
+
+func add_control(root: Node, parent: Node, control: Control, metadata: Dictionary) -> void:
+	for key in metadata:
+		control.set_meta(key, metadata[key])
+	parent.add_child(control)
+	control.owner = root
+
+
+func _physics_process(_delta: float) -> bool:
+	if databind == null:
+		return false
+
+	# Divergences only hold the last check, collect them every frame.
+	for divergence in databind.get_reference_divergences():
+		divergences += 1
+		printerr("Divergence: %s" % divergence)
+
+	frame += 1
+	if frame < frames:
+		return false
+
+	var quarantined: Array = databind.get_quarantined_bindings()
+	for binding in quarantined:
+		printerr("Failing binding: %s" % binding)
+
+	print("frames: %d divergences: %d failing bindings: %d" % [frames, divergences, quarantined.size()])
+	quit(1 if divergences > 0 or not quarantined.is_empty() else 0)
+	return false
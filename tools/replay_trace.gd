@@ -0,0 +1,22 @@
+# Replays a DataBind trace headless and prints how long applying it took.
+# godot --headless --script res://tools/replay_trace.gd -- user://hud.dbtrace
+extends SceneTree
+
+
+func _initialize() -> void:
+	var args := OS.get_cmdline_user_args()
+	if args.is_empty():
+		printerr("Usage: godot --headless --script res://tools/replay_trace.gd -- <trace>")
+		quit(1)
+		return
+
+	var stats: Dictionary = DataBind.replay_trace(args[0])
+	if stats.is_empty():
+		quit(1)
+		return
+
+	for key in stats:
+		print("%s: %s" % [key, stats[key]])
+	if stats["updates"] > 0:
+		print("avg_update_usec: %.1f" % (float(stats["replay_usec"]) / stats["updates"]))
+	quit()